@@ -0,0 +1,54 @@
+#include "General.hpp"
+
+// Times the hot paths on the headless backend, so the numbers only measure ncursespp itself and not a terminal
+
+/// @brief Measure - Run a case a number of times
+/// @param name Name of the case
+/// @param runs Amount of times to run the case
+/// @param unit Amount of units (lines, sweeps, ...) each run handles, for the per-unit time
+/// @param setup Run before each run without being timed
+/// @param work The case itself
+static void measure(const char *name, unsigned int runs, unsigned int unit, std::function<void()> setup, std::function<void()> work) {
+    std::chrono::steady_clock::duration total(0);
+
+    for (unsigned int i = 0; i < runs; i++) {
+        setup();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        work();
+        total += std::chrono::steady_clock::now() - start;
+    }
+
+    double nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(total).count() / (double)runs / unit;
+    if (nanos >= 1000000) {printf("%-40s %10.2f ms\n", name, nanos / 1000000);}
+    else if (nanos >= 1000) {printf("%-40s %10.2f us\n", name, nanos / 1000);}
+    else {printf("%-40s %10.2f ns\n", name, nanos);}
+}
+
+int main() {
+    npp::initHeadless(24, 80);
+    npp::Window win(0, 0, 24, 80);
+
+    // Radial reveal of a full 80x24 window (every cell changes, so every cell gets revealed)
+    for (unsigned short y = 0; y < 24; y++) {win.wstr(y, 0, std::wstring(80, L'#'));}
+    measure("rrad (80x24, 2 divisions)", 50, 1, [&]() {
+        win.clear();
+        npp::mterm.flush();
+        npp::mterm.clearCapture();
+    }, [&]() {win.rrad();});
+    printf("%-40s %10lu cells\n", "rrad cells written per sweep", win.gstats().Cells);
+
+    // Writing 80 column lines of text, as wide strings and as UTF-8 (the ASCII between non-ASCII characters is widened up to 16 bytes at a time where SSE2 is available)
+    std::wstring asciiWide(80, L'a'), mixedWide;
+    for (unsigned short i = 0; i < 80; i++) {mixedWide += (i % 8 == 7) ? L'é' : (wchar_t)(L'a' + i % 26);}
+    std::string ascii(80, 'a'), mixed;
+    for (unsigned short i = 0; i < 80; i++) {mixed += (i % 8 == 7) ? "\xC3\xA9" : std::string(1, (char)('a' + i % 26));}
+
+    std::function<void()> none = []() {};
+    measure("wstr wide (ASCII line)", 20000, 24, none, [&]() {for (unsigned short y = 0; y < 24; y++) {win.wstr(y, 0, asciiWide);}});
+    measure("wstr UTF-8 (ASCII line)", 20000, 24, none, [&]() {for (unsigned short y = 0; y < 24; y++) {win.wstr(y, 0, ascii);}});
+    measure("wstr wide (1 in 8 non-ASCII)", 20000, 24, none, [&]() {for (unsigned short y = 0; y < 24; y++) {win.wstr(y, 0, mixedWide);}});
+    measure("wstr UTF-8 (1 in 8 non-ASCII)", 20000, 24, none, [&]() {for (unsigned short y = 0; y < 24; y++) {win.wstr(y, 0, mixed);}});
+
+    npp::end();
+    return 0;
+}
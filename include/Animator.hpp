@@ -0,0 +1,57 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    class Window;
+
+    /// @brief A render animation that advances by elapsed time instead of by sleeping in between each of its steps
+    struct Animation {
+        /// @brief Window that the animation renders (it must outlive the animation)
+        Window *Win = nullptr;
+        /// @brief Amount of steps the animation takes
+        unsigned long Steps = 0;
+        /// @brief Milliseconds the whole animation should take
+        unsigned long Millis = 0;
+        /// @brief Writes a single step (given its index) without presenting it
+        std::function<void(unsigned long)> Step;
+        /// @brief Writes whatever is left once the animation ends or gets skipped, without presenting it
+        std::function<void()> Finish;
+
+        /// @brief Amount of steps that have been written so far
+        unsigned long Done = 0;
+        /// @brief When the animation was added to the animator
+        std::chrono::steady_clock::time_point Start;
+    };
+
+    /// @brief Frame-clock scheduler - runs any amount of animations (across any amount of windows) together, presenting once per tick and dropping intermediate frames whenever output falls behind
+    class Animator {
+        private:
+            /// @brief Animations that haven't finished yet
+            std::vector<Animation> Active;
+
+            /// @brief Present - Show everything the touched windows have written, all at once
+            /// @param touched Windows that were written to during the tick
+            void present(const std::vector<Window*> &touched);
+
+        public:
+            /// @brief Add - Start running an animation (its clock starts now)
+            /// @param anim Animation to run, most likely from Window::aline() or Window::arad()
+            void add(Animation anim);
+
+            /// @brief Tick - Write every step that is due for each animation and present them together
+            /// @returns True if there are still animations running, false if not
+            bool tick();
+            /// @brief Run - Tick until every animation has finished, sleeping in between steps (and skipping all animations if a skippable window gets an input)
+            void run();
+            /// @brief Skip - Finish every animation right now
+            void skip();
+
+            /// @brief Get Active - Get the amount of animations that are still running
+            /// @returns The amount of animations that are still running
+            const unsigned long gactive();
+    };
+
+    /// @brief The animator that rline() and rrad() run through
+    extern Animator manim;
+}
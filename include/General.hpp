@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ncurses.h>
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <locale.h>
@@ -8,9 +9,24 @@
 #include <math.h>
 #include <cmath>
 #include <ctime>
-
-#include "Window.hpp"
-#include "Mouse.hpp"
+#include <cerrno>
+#include <unistd.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <new>
+#include <cstdlib>
+#include <cwchar>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 /// @brief Unknown mouse input
 #define M_UNKNOWN -1
@@ -64,6 +80,43 @@
 #define M5_DCLICK 23
 /// @brief Mouse 5 (Scroll Down being clicked thrice quickly (DOESN'T DO ANYTHING)
 #define M5_TCLICK 24
+/// @brief The mouse moving (reported when REPORT_MOUSE_POSITION is on; only the latest position of each batch is delivered)
+#define M_MOVE 25
+
+/// @brief Amount of bits that ncurses attributes are shifted down by when packed into a cell (attr_t >> ATTR_SHIFT)
+#define ATTR_SHIFT 16
+/// @brief Standout attribute bit within a cell
+#define ATTR_STANDOUT (A_STANDOUT >> ATTR_SHIFT)
+/// @brief Underline attribute bit within a cell
+#define ATTR_UNDERLINE (A_UNDERLINE >> ATTR_SHIFT)
+/// @brief Reverse attribute bit within a cell
+#define ATTR_REVERSE (A_REVERSE >> ATTR_SHIFT)
+/// @brief Blink attribute bit within a cell
+#define ATTR_BLINK (A_BLINK >> ATTR_SHIFT)
+/// @brief Dim attribute bit within a cell
+#define ATTR_DIM (A_DIM >> ATTR_SHIFT)
+/// @brief Bold attribute bit within a cell
+#define ATTR_BOLD (A_BOLD >> ATTR_SHIFT)
+/// @brief Alternate character set attribute bit within a cell
+#define ATTR_ALTCHARSET (A_ALTCHARSET >> ATTR_SHIFT)
+/// @brief Invisible attribute bit within a cell
+#define ATTR_INVIS (A_INVIS >> ATTR_SHIFT)
+/// @brief Protected attribute bit within a cell
+#define ATTR_PROTECT (A_PROTECT >> ATTR_SHIFT)
+/// @brief Italic attribute bit within a cell
+#define ATTR_ITALIC (A_ITALIC >> ATTR_SHIFT)
+
+/// @brief Flag that marks a packed 24-bit color as set (cells with a color of 0 fall back to their color pair)
+#define RGB_SET 0x1000000
+/// @brief Stands for a terminal's default color (used by the native backend for pairs that use -1)
+#define COLOR_UNSET 0x2000000
+
+/// @brief Render windows through ncurses
+#define BACKEND_NCURSES 0
+/// @brief Render windows by writing escape sequences straight to the terminal (ncurses is still used for input)
+#define BACKEND_NATIVE 1
+/// @brief Render windows into an in-memory terminal model without a real terminal or ncurses screen (for tests and benchmarks)
+#define BACKEND_HEADLESS 2
 
 /// @brief Light box drawing characters with square corners
 #define LIGHT_HARD 0
@@ -113,19 +166,165 @@
 /// @brief Right (used for extracting directions and connection styles from box drawing characters)
 #define DIR_RIGHT 3
 
+/// @brief Reveal the window row by row, top to bottom
+#define TRANSITION_ROWS 0
+/// @brief Reveal the window column by column, left to right
+#define TRANSITION_COLS 1
+/// @brief Reveal the window cell by cell, row after row (param 1 goes right to left within each row)
+#define TRANSITION_CELLS_BY_ROW 2
+/// @brief Reveal the window cell by cell, column after column (param 1 goes bottom to top within each column)
+#define TRANSITION_CELLS_BY_COL 3
+/// @brief Reveal the window by sweeping around its center counter-clockwise from the midpoint of the right edge (param is the amount of divisions)
+#define TRANSITION_RADIAL 4
+/// @brief Reveal the window in a clockwise spiral from the top-left corner to the center
+#define TRANSITION_SPIRAL 5
+/// @brief Reveal the window's cells in a random (but repeatable) order
+#define TRANSITION_DISSOLVE 6
+/// @brief Reveal the window diagonally from the top-left corner to the bottom-right corner
+#define TRANSITION_DIAGONAL 7
+
+/// @brief Reveal at a constant rate
+#define CURVE_LINEAR 0
+/// @brief Start slow and speed up
+#define CURVE_EASE_IN 1
+/// @brief Start fast and slow down
+#define CURVE_EASE_OUT 2
+/// @brief Start slow, speed up, and slow down again
+#define CURVE_EASE_IN_OUT 3
+
+/// @brief Size of the stack buffers that numbers get formatted into (the most characters a formatted number can take up)
+#define NUM_BUFFER 64
+
+/// @brief Milliseconds in each frame of a transition (about 60 frames a second), which is what the cells revealed per step are batched by
+#define FRAME_MILLIS 16
+
+#include "Terminal.hpp"
+#include "Palette.hpp"
+#include "Animator.hpp"
+#include "Input.hpp"
+#include "HitMap.hpp"
+#include "LineDrawing.hpp"
+#include "MatrixText.hpp"
+
 namespace npp {
+    /// @brief RGB - Pack a 24-bit color for the truecolor write functions
+    /// @param r Red component (0-255)
+    /// @param g Green component (0-255)
+    /// @param b Blue component (0-255)
+    /// @returns The packed color (RGB_SET | 0xRRGGBB)
+    constexpr unsigned int rgb(unsigned char r, unsigned char g, unsigned char b) {return RGB_SET | (unsigned int)r << 16 | (unsigned int)g << 8 | b;}
+
+    /// @brief RGB Level - Snap a color channel to one of the six levels (0, 95, 135, 175, 215, 255) of the xterm 256 color cube
+    /// @param v Channel value (0-255)
+    /// @returns The level (0-5)
+    constexpr unsigned char rgbLevel(unsigned char v) {return v < 48 ? 0 : v < 115 ? 1 : (v - 35) / 40;}
+    /// @brief RGB Index - Find the closest color in the xterm 256 color cube/grayscale ramp (used when a terminal can't show 24-bit color)
+    /// @param color A packed color made with rgb()
+    /// @returns A color number (16-255)
+    constexpr short rgbIndex(unsigned int color) {
+        return ((color >> 16 & 0xFF) == (color >> 8 & 0xFF) && (color >> 8 & 0xFF) == (color & 0xFF) && (color & 0xFF) > 8 && (color & 0xFF) < 238)
+            ? 232 + ((color & 0xFF) - 8) / 10
+            : 16 + 36 * rgbLevel(color >> 16 & 0xFF) + 6 * rgbLevel(color >> 8 & 0xFF) + rgbLevel(color & 0xFF);
+    }
+
+    /// @brief A set of attributes (ATTR_* bits) that is parsed once instead of on every write - strings like "bo un" turn into one implicitly (at compile time for literals assigned to a constexpr TextStyle)
+    class TextStyle {
+        public:
+            /// @brief Set of ATTR_* bits
+            unsigned short Attr = 0;
+
+            /// @brief Create a style without any attributes
+            constexpr TextStyle() {}
+            /// @brief Create a style from a set of ATTR_* bits
+            /// @param attr Set of ATTR_* bits
+            constexpr explicit TextStyle(unsigned short attr) : Attr(attr) {}
+            /// @brief Create a style from a set of attributes (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param input String to parse (not case sensitive)
+            constexpr TextStyle(const char *input) : Attr(parse(input)) {}
+            /// @brief Create a style from a set of attributes (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param input String to parse (not case sensitive)
+            TextStyle(const std::string &input) : Attr(parse(input.c_str())) {}
+
+            /// @brief Combine two styles
+            /// @param other Style to combine with
+            /// @returns A style with the attributes of both
+            constexpr TextStyle operator|(TextStyle other) const {return TextStyle((unsigned short)(Attr | other.Attr));}
+            /// @brief Compare two styles
+            /// @param other Style to compare with
+            /// @returns True if both styles have the same attributes
+            constexpr bool operator==(TextStyle other) const {return Attr == other.Attr;}
+
+            /// @brief Parse - Turn a string of two-letter attribute codes into a set of ATTR_* bits
+            /// @param input String to parse (not case sensitive, the codes can be anywhere in it)
+            /// @returns A set of ATTR_* bits
+            static constexpr unsigned short parse(const char *input) {
+                unsigned short output = 0;
+                if (input == nullptr) {return output;}
+
+                for (unsigned int i = 0; input[i] != '\0' && input[i + 1] != '\0'; i++) {
+                    // Every code is two letters, so each neighbouring pair of characters is checked
+                    char a = (input[i] >= 'A' && input[i] <= 'Z') ? input[i] - 'A' + 'a' : input[i];
+                    char b = (input[i + 1] >= 'A' && input[i + 1] <= 'Z') ? input[i + 1] - 'A' + 'a' : input[i + 1];
+
+                    if (a == 'b' && b == 'o') {output |= ATTR_BOLD;}
+                    else if (a == 'i' && b == 't') {output |= ATTR_ITALIC;}
+                    else if (a == 'u' && b == 'n') {output |= ATTR_UNDERLINE;}
+                    else if (a == 'r' && b == 'e') {output |= ATTR_REVERSE;}
+                    else if (a == 'b' && b == 'l') {output |= ATTR_BLINK;}
+                    else if (a == 'd' && b == 'i') {output |= ATTR_DIM;}
+                    else if (a == 'i' && b == 'n') {output |= ATTR_INVIS;}
+                    else if (a == 's' && b == 't') {output |= ATTR_STANDOUT;}
+                    else if (a == 'p' && b == 'r') {output |= ATTR_PROTECT;}
+                    else if (a == 'a' && b == 'l') {output |= ATTR_ALTCHARSET;}
+                }
+
+                return output;
+            }
+    };
+
+    /// @brief How a number gets formatted by wlong(), wfloat() and numeric fields
+    struct NumFormat {
+        /// @brief Minimum amount of characters for the number to take up, sign included (leading zeros are added after the sign to meet it, up to NUM_BUFFER)
+        unsigned short MinWidth = 0;
+        /// @brief Digits after the decimal point (for whole numbers this makes them fixed-point, so 12345 with a precision of 2 is written as 123.45)
+        unsigned char Precision = 0;
+        /// @brief Character put between every group of three digits before the decimal point, L'\0' for none
+        wchar_t Separator = L'\0';
+    };
+
+    /// @brief Format Integer - Format a (fixed-point) whole number into a buffer without allocating
+    /// @param buffer Buffer to format into
+    /// @param input Number to format
+    /// @param format Minimum width, precision (the amount of the number's last digits that go after the decimal point) and thousands separator
+    /// @returns The amount of characters written to the buffer
+    unsigned short formatInt(wchar_t (&buffer)[NUM_BUFFER], long long input, NumFormat format);
+    /// @brief Format Float - Format a decimal number into a buffer without allocating (anything too large for a 64-bit fixed-point number at the given precision is written in scientific notation, without separators)
+    /// @param buffer Buffer to format into
+    /// @param input Number to format
+    /// @param format Minimum width, precision (digits after the decimal point, the rest is rounded off) and thousands separator
+    /// @returns The amount of characters written to the buffer
+    unsigned short formatFloat(wchar_t (&buffer)[NUM_BUFFER], double input, NumFormat format);
+
+    /// @brief Decode UTF-8 - Decode the next character of a UTF-8 string (used for both written strings and raw input)
+    /// @param input Start of the character, moved past it
+    /// @param end End of the string
+    /// @returns The character, U+FFFD if its bytes are malformed (only a single byte is skipped then)
+    wchar_t decodeUtf8(const unsigned char *&input, const unsigned char *end);
+
     /// @brief Default values that can be changed in place of providing parameter arguments for many functions
     static struct {
         /// @brief Color pair
         unsigned char Color = 1;
         /// @brief The set of attributes to use by default when writing to the window
-        std::string Attributes = "";
+        TextStyle Attributes;
         /// @brief The pair of y (row) and x (col) offsets to use when chaining writing functions
         std::pair<unsigned short, unsigned short> Offset = {0, 1};
         /// @brief Whether to wrap to the starting x or to the window's x
         bool Wrap = true;
         /// @brief The minimum width of various numbers to have (in characters) when written to the window
         unsigned short MinWidth = 0;
+        /// @brief The format to use when writing numbers with wlong(), wfloat() and numeric fields
+        NumFormat Format;
 
         bool DanglingLetters = true;
         unsigned short Kerning = 1;
@@ -136,143 +335,29 @@ namespace npp {
         bool CanMerge = true;
     } Defaults;
 
-    /// @brief Various keys used to store and request information relevant to each key
-    static const struct {
-        /// @brief The key that matches unicode box drawing characters to the directions/styles that make them up
-        std::vector<std::pair<wchar_t, std::vector<unsigned char>>> LineDrawing = {
-            // Horizontal and vertical lines off all 6 dash styles (none, single 1, single 2, double, triple, quadruple)
-            {L'─', {0, 0, 1, 1}}, {L'╌', {0, 0, 1, 1}}, {L'┄', {0, 0, 1, 1}}, {L'┈', {0, 0, 1, 1}}, {L'╴', {0, 0, 1, 1}}, {L'╶', {0, 0, 1, 1}},
-            {L'━', {0, 0, 2, 2}}, {L'╍', {0, 0, 2, 2}}, {L'┅', {0, 0, 2, 2}}, {L'┉', {0, 0, 2, 2}}, {L'╸', {0, 0, 2, 2}}, {L'╺', {0, 0, 2, 2}},
-            {L'│', {1, 1, 0, 0}}, {L'╎', {1, 1, 0, 0}}, {L'┆', {1, 1, 0, 0}}, {L'┊', {1, 1, 0, 0}}, {L'╵', {1, 1, 0, 0}}, {L'╷', {1, 1, 0, 0}},
-            {L'┃', {2, 2, 0, 0}}, {L'╏', {2, 2, 0, 0}}, {L'┇', {2, 2, 0, 0}}, {L'┋', {2, 2, 0, 0}}, {L'╹', {2, 2, 0, 0}}, {L'╻', {2, 2, 0, 0}},
-            {L'═', {0, 0, 3, 3}}, {L'║', {3, 3, 0, 0}},
-            // Corners
-            {L'┌', {0, 1, 0, 1}}, {L'╭', {0, 1, 0, 1}}, {L'┐', {0, 1, 1, 0}}, {L'╮', {0, 1, 1, 0}}, {L'└', {1, 0, 0, 1}}, {L'╰', {1, 0, 0, 1}}, {L'┘', {1, 0, 1, 0}}, {L'╯', {1, 0, 1, 0}}, 
-            {L'┍', {0, 1, 0, 2}}, {L'┎', {0, 2, 0, 1}}, {L'┏', {0, 2, 0, 2}}, {L'╒', {0, 1, 0, 3}}, {L'╓', {0, 3, 0, 1}}, {L'╔', {0, 3, 0, 3}},
-            {L'┑', {0, 1, 2, 0}}, {L'┒', {0, 2, 1, 0}}, {L'┓', {0, 2, 2, 0}}, {L'╕', {0, 1, 3, 0}}, {L'╖', {0, 3, 1, 0}}, {L'╗', {0, 3, 3, 0}},
-            {L'┕', {1, 0, 0, 2}}, {L'┖', {2, 0, 0, 1}}, {L'┗', {2, 0, 0, 2}}, {L'╘', {1, 0, 0, 3}}, {L'╙', {3, 0, 0, 1}}, {L'╚', {3, 0, 0, 3}},
-            {L'┙', {1, 0, 2, 0}}, {L'┚', {2, 0, 1, 0}}, {L'┛', {2, 0, 2, 0}}, {L'╛', {1, 0, 3, 0}}, {L'╜', {3, 0, 1, 0}}, {L'╝', {3, 0, 3, 0}},
-            // Tees
-            {L'├', {1, 1, 0, 1}}, {L'┝', {1, 1, 0, 2}}, {L'┞', {2, 1, 0, 1}}, {L'┟', {1, 2, 0, 1}}, {L'┠', {2, 2, 0, 1}}, {L'┡', {2, 1, 0, 2}}, {L'┢', {1, 2, 0, 2}}, {L'┣', {2, 2, 0, 2}}, {L'╞', {1, 1, 0, 3}}, {L'╟', {3, 3, 0, 1}}, {L'╠', {3, 3, 0, 3}},
-            {L'┤', {1, 1, 1, 0}}, {L'┥', {1, 1, 2, 0}}, {L'┦', {2, 1, 1, 0}}, {L'┧', {1, 2, 1, 0}}, {L'┨', {2, 2, 1, 0}}, {L'┩', {2, 1, 2, 0}}, {L'┪', {1, 2, 2, 0}}, {L'┫', {2, 2, 2, 0}}, {L'╡', {1, 1, 3, 0}}, {L'╢', {3, 3, 1, 0}}, {L'╣', {3, 3, 3, 0}},
-            {L'┬', {0, 1, 1, 1}}, {L'┭', {0, 1, 2, 1}}, {L'┮', {0, 1, 1, 2}}, {L'┯', {0, 1, 2, 2}}, {L'┰', {0, 2, 1, 1}}, {L'┱', {0, 2, 2, 1}}, {L'┲', {0, 2, 1, 2}}, {L'┳', {0, 2, 2, 2}}, {L'╤', {0, 1, 3, 3}}, {L'╥', {0, 3, 1, 1}}, {L'╦', {0, 3, 3, 3}},
-            {L'┴', {1, 0, 1, 1}}, {L'┵', {1, 0, 2, 1}}, {L'┶', {1, 0, 1, 2}}, {L'┷', {1, 0, 2, 2}}, {L'┸', {2, 0, 1, 1}}, {L'┹', {2, 0, 2, 1}}, {L'┺', {2, 0, 1, 2}}, {L'┻', {2, 0, 2, 2}}, {L'╧', {1, 0, 3, 3}}, {L'╨', {3, 0, 1, 1}}, {L'╩', {3, 0, 3, 3}},
-            // Crosses
-            {L'┼', {1, 1, 1, 1}}, {L'┽', {1, 1, 2, 1}}, {L'┾', {1, 1, 1, 2}}, {L'┿', {1, 1, 2, 2}}, {L'╀', {2, 1, 1, 1}}, {L'╁', {1, 2, 1, 1}}, {L'╂', {2, 2, 1, 1}}, {L'╃', {2, 1, 2, 1}},
-            {L'╄', {2, 1, 1, 2}}, {L'╅', {1, 2, 2, 1}}, {L'╆', {1, 2, 1, 2}}, {L'╇', {2, 2, 1, 2}}, {L'╈', {1, 2, 2, 2}}, {L'╉', {2, 2, 2, 1}}, {L'╊', {2, 2, 1, 2}}, {L'╋', {2, 2, 2, 2}},
-            {L'╪', {1, 1, 3, 3}}, {L'╫', {3, 3, 1, 1}}, {L'╬', {3, 3, 3, 3}},
-            // Thickness transitions
-            {L'╼', {0, 0, 1, 2}}, {L'╽', {1, 2, 0, 0}}, {L'╾', {0, 0, 2, 1}}, {L'╿', {2, 1, 0, 0}}
-        };
-
-        /// @brief The key that matches a 3x3 set of unicode box element characters to the regular character they represent
-        std::vector<std::pair<char, std::vector<std::vector<wchar_t>>>> MatrixText6x6 = {
-            {' ', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L' ', L' '}}},
-            {'a', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}}},
-            {'b', {{L'▌', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▛', L'▄', L'▞'}}},
-            {'c', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▀'}, {L'▚', L'▄', L'▄'}}},
-            {'d', {{L' ', L' ', L'▐'}, {L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}}},
-            {'e', {{L' ', L' ', L' '}, {L'▟', L'█', L'▙'}, {L'▚', L'▄', L'▄'}}},
-            {'f', {{L' ', L'▞', L'▖'}, {L'▗', L'▙', L'▖'}, {L' ', L'▌', L' '}}},
-            {'g', {{L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}, {L'▗', L'▄', L'▞'}}},
-            {'h', {{L'▌', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▌', L' ', L'▐'}}},
-            {'i', {{L' ', L'▘', L' '}, {L' ', L'▌', L' '}, {L' ', L'▚', L' '}}},
-            {'j', {{L' ', L'▝', L' '}, {L' ', L'▐', L' '}, {L'▝', L'▞', L' '}}},
-            {'k', {{L'▌', L' ', L' '}, {L'▙', L'▄', L'▘'}, {L'▌', L' ', L'▌'}}},
-            {'l', {{L' ', L'▌', L' '}, {L' ', L'▌', L' '}, {L' ', L'▚', L' '}}},
-            {'m', {{L' ', L' ', L' '}, {L'▛', L'▞', L'▖'}, {L'▌', L'▌', L'▌'}}},
-            {'n', {{L' ', L' ', L' '}, {L'▛', L'▀', L'▚'}, {L'▌', L' ', L'▐'}}},
-            {'o', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'p', {{L'▞', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L' '}}},
-            {'q', {{L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▟'}, {L' ', L' ', L'▐'}}},
-            {'r', {{L' ', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▌', L' ', L' '}}},
-            {'s', {{L'▗', L'▄', L'▖'}, {L'▚', L'▄', L'▖'}, {L'▗', L'▄', L'▞'}}},
-            {'t', {{L' ', L'▌', L' '}, {L'▀', L'▛', L'▀'}, {L' ', L'▚', L' '}}},
-            {'u', {{L' ', L' ', L' '}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▟'}}},
-            {'v', {{L' ', L' ', L' '}, {L'▌', L' ', L'▐'}, {L'▝', L'▄', L'▘'}}},
-            {'w', {{L' ', L' ', L' '}, {L'▐', L'▐', L'▐'}, {L'▝', L'▞', L'▟'}}},
-            {'x', {{L' ', L' ', L' '}, {L'▝', L'▄', L'▘'}, {L'▗', L'▀', L'▖'}}},
-            {'y', {{L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▟'}, {L'▗', L'▄', L'▞'}}},
-            {'z', {{L'▄', L'▄', L'▄'}, {L'▗', L'▄', L'▞'}, {L'▙', L'▄', L'▄'}}},
-            {'A', {{L'▞', L'▀', L'▚'}, {L'▙', L'▄', L'▟'}, {L'▌', L' ', L'▐'}}},
-            {'B', {{L'▛', L'▀', L'▚'}, {L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}}},
-            {'C', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L' '}, {L'▚', L'▄', L'▞'}}},
-            {'D', {{L'▛', L'▀', L'▚'}, {L'▌', L' ', L'▐'}, {L'▙', L'▄', L'▞'}}},
-            {'E', {{L'▛', L'▀', L'▀'}, {L'▛', L'▀', L'▀'}, {L'▙', L'▄', L'▄'}}},
-            {'F', {{L'▛', L'▀', L'▀'}, {L'▛', L'▀', L'▀'}, {L'▌', L' ', L' '}}},
-            {'G', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L'▄'}, {L'▚', L'▄', L'▟'}}},
-            {'H', {{L'▌', L' ', L'▐'}, {L'▛', L'▀', L'▜'}, {L'▌', L' ', L'▐'}}},
-            {'I', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L'▄', L'▟', L'▄'}}},
-            {'J', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L'▚', L'▟', L' '}}},
-            {'K', {{L'▌', L' ', L'▞'}, {L'▛', L'▀', L'▖'}, {L'▌', L' ', L'▐'}}},
-            {'L', {{L'▌', L' ', L' '}, {L'▌', L' ', L' '}, {L'▙', L'▄', L'▄'}}},
-            {'M', {{L'▙', L' ', L'▟'}, {L'▌', L'▀', L'▐'}, {L'▌', L' ', L'▐'}}},
-            {'N', {{L'▙', L' ', L'▐'}, {L'▌', L'▚', L'▐'}, {L'▌', L' ', L'▜'}}},
-            {'O', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▞'}}},
-            {'P', {{L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L' '}}},
-            {'Q', {{L'▞', L'▀', L'▚'}, {L'▌', L'▗', L'▐'}, {L'▚', L'▄', L'▚'}}},
-            {'R', {{L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L'▐'}}},
-            {'S', {{L'▞', L'▀', L'▘'}, {L'▝', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'T', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L' ', L'▐', L' '}}},
-            {'U', {{L'▌', L' ', L'▐'}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▞'}}},
-            {'V', {{L'▌', L' ', L'▐'}, {L'▚', L' ', L'▞'}, {L'▝', L'▄', L'▘'}}},
-            {'W', {{L'▌', L' ', L'▐'}, {L'▌', L'▄', L'▐'}, {L'▛', L' ', L'▜'}}},
-            {'X', {{L'▚', L' ', L'▞'}, {L' ', L'█', L' '}, {L'▞', L' ', L'▚'}}},
-            {'Y', {{L'▌', L' ', L'▐'}, {L'▝', L'▄', L'▘'}, {L' ', L'█', L' '}}},
-            {'Z', {{L'▀', L'▀', L'▜'}, {L'▗', L'▞', L'▘'}, {L'▙', L'▄', L'▄'}}},
-            {'0', {{L'▞', L'▀', L'▙'}, {L'▌', L'▞', L'▐'}, {L'▜', L'▄', L'▞'}}},
-            {'1', {{L' ', L'▟', L' '}, {L' ', L'▐', L' '}, {L' ', L'▟', L'▖'}}},
-            {'2', {{L'▞', L'▀', L'▚'}, {L' ', L'▗', L'▞'}, {L'▟', L'▙', L'▄'}}},
-            {'3', {{L'▞', L'▀', L'▚'}, {L' ', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'4', {{L'▌', L' ', L'▌'}, {L'▝', L'▀', L'▛'}, {L' ', L' ', L'▌'}}},
-            {'5', {{L'▛', L'▀', L'▀'}, {L'▀', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'6', {{L'▞', L'▀', L'▀'}, {L'▛', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'7', {{L'▀', L'▀', L'▜'}, {L' ', L'▗', L'▘'}, {L' ', L'▌', L' '}}},
-            {'8', {{L'▞', L'▀', L'▚'}, {L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
-            {'9', {{L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▟'}, {L'▗', L'▄', L'▟'}}},
-            {'`', {{L'▗', L' ', L' '}, {L' ', L'▘', L' '}, {L' ', L' ', L' '}}},
-            {'~', {{L'▗', L'▖', L'▗'}, {L'▘', L'▝', L'▘'}, {L' ', L' ', L' '}}},
-            {'!', {{L' ', L'█', L' '}, {L' ', L'█', L' '}, {L' ', L'▄', L' '}}},
-            {'@', {{L'▞', L'▀', L'▚'}, {L'▌', L'█', L'▟'}, {L'▚', L'▄', L'▄'}}},
-            {'#', {{L'▟', L'▄', L'▙'}, {L'▐', L' ', L'▌'}, {L'▜', L'▀', L'▛'}}},
-            {'$', {{L'▗', L'▙', L'▖'}, {L'▚', L'▙', L'▖'}, {L'▗', L'▙', L'▞'}}},
-            {'%', {{L'█', L' ', L'▞'}, {L' ', L'▞', L' '}, {L'▞', L' ', L'█'}}},
-            {'^', {{L' ', L'▄', L' '}, {L'▝', L' ', L'▘'}, {L' ', L' ', L' '}}},
-            {'&', {{L'▞', L'▚', L' '}, {L'▞', L'▌', L'▖'}, {L'▚', L'▞', L'▖'}}},
-            {'*', {{L'▝', L'▄', L'▘'}, {L'▗', L'▀', L'▖'}, {L' ', L' ', L' '}}},
-            {'(', {{L' ', L'▞', L'▘'}, {L'▐', L' ', L' '}, {L' ', L'▚', L'▖'}}},
-            {')', {{L'▝', L'▚', L' '}, {L' ', L' ', L'▌'}, {L'▗', L'▞', L' '}}},
-            {'-', {{L' ', L' ', L' '}, {L'▗', L'▄', L'▖'}, {L' ', L' ', L' '}}},
-            {'_', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L'▄', L'▄', L'▄'}}},
-            {'=', {{L' ', L' ', L' '}, {L'▄', L'█', L'▄'}, {L' ', L'▀', L' '}}},
-            {'+', {{L' ', L' ', L' '}, {L'▝', L'▀', L'▘'}, {L'▝', L'▀', L'▘'}}},
-            {'[', {{L'▐', L'▀', L'▘'}, {L'▐', L' ', L' '}, {L'▐', L'▄', L'▖'}}},
-            {'{', {{L' ', L'▛', L'▘'}, {L'█', L' ', L' '}, {L' ', L'▙', L'▖'}}},
-            {']', {{L'▝', L'▀', L'▌'}, {L' ', L' ', L'▌'}, {L'▗', L'▄', L'▌'}}},
-            {'}', {{L'▝', L'▜', L' '}, {L' ', L' ', L'█'}, {L'▗', L'▟', L' '}}},
-            {'\\', {{L' ', L'█', L' '}, {L' ', L'█', L' '}, {L' ', L'█', L' '}}},
-            {'|', {{L'▚', L' ', L' '}, {L' ', L'▚', L' '}, {L' ', L' ', L'▚'}}},
-            {';', {{L' ', L' ', L' '}, {L' ', L'▀', L' '}, {L' ', L'▜', L' '}}},
-            {':', {{L' ', L' ', L' '}, {L' ', L'▀', L' '}, {L' ', L'▄', L' '}}},
-            {'\'', {{L' ', L'▗', L'▖'}, {L' ', L' ', L'▘'}, {L' ', L' ', L' '}}},
-            {'"', {{L'▗', L' ', L'▖'}, {L'▝', L' ', L'▘'}, {L' ', L' ', L' '}}},
-            {',', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L'▜', L' '}}},
-            {'<', {{L' ', L'▗', L'▖'}, {L'▐', L'▌', L' '}, {L' ', L'▝', L'▘'}}},
-            {'.', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L'▄', L' '}}},
-            {'>', {{L'▗', L'▖', L' '}, {L' ', L'▐', L'▌'}, {L'▝', L'▘', L' '}}},
-            {'?', {{L'▞', L'▀', L'▚'}, {L' ', L'▄', L'▘'}, {L' ', L'▄', L' '}}},
-            {'/', {{L' ', L' ', L'▞'}, {L' ', L'▞', L' '}, {L'▞', L' ', L' '}}},
-        };
-    } Keys;
-
     /// @brief Initialize - Acts as the ncursespp version of initscr() with a few other initializations; end() must be called at the end of a program
     /// @param useMouse Whether to set up the ability to take mouse inputs or not
+    /// @param backend Which backend windows render through: BACKEND_NCURSES or BACKEND_NATIVE (escape sequences written straight to the terminal)
     /// @returns True or false for whether the user's terminal will have full color support
-    bool init(bool useMouse = false);
+    bool init(bool useMouse = false, unsigned char backend = BACKEND_NCURSES);
+    /// @brief Initialize Headless - Set up ncursespp to render into an in-memory terminal model instead of a real terminal (ncurses is never started, and there's no input); end() must still be called at the end of a program
+    /// @param dimy Height (rows) of the simulated screen
+    /// @param dimx Length (cols) of the simulated screen
+    void initHeadless(unsigned short dimy = 24, unsigned short dimx = 80);
 
     /// @brief End - Acts as the ncursespp version of endwin() with some extra cleanup
     /// @param useMouse Whether to clean up the mouse settings or not
     /// @param funcReturn An integer for the function to return (especially useful for reducing clutter in a main() function or smth)
     /// @returns funcReturn
     int end(bool useMouse = false, int funcReturn = 0);
+
+#ifdef NPP_DEBUG
+    /// @brief Get Allocations - Get the amount of heap allocations made so far (debug builds only, where every operator new is counted); compare it before and after a frame to make sure the frame didn't allocate
+    /// @returns The amount of allocations made since the program started
+    unsigned long gallocs();
+#endif
 }
+
+// Windows use everything above, so they come last
+#include "Window.hpp"
+#include "Mouse.hpp"
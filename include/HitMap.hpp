@@ -0,0 +1,119 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    /// @brief Hit-test registry - keeps track of clickable rectangles (with a z-order) and finds the one under a position without scanning all of them
+    class HitMap {
+        private:
+            /// @brief A clickable rectangle
+            struct Region {
+                /// @brief y-position (row) of the top-left corner
+                unsigned short Y = 0;
+                /// @brief x-position (col) of the top-left corner
+                unsigned short X = 0;
+                /// @brief Height (rows)
+                unsigned short DimY = 0;
+                /// @brief Length (cols)
+                unsigned short DimX = 0;
+                /// @brief Regions with a higher z are on top
+                int Z = 0;
+                /// @brief When the region was last added/raised (breaks ties between regions with the same z, newest on top)
+                unsigned long Order = 0;
+                /// @brief Whether the slot is in use
+                bool Used = false;
+            };
+
+            /// @brief A rectangle of buckets (both ends inclusive, empty if a first is past its last)
+            struct Span {
+                /// @brief First row of buckets
+                unsigned short FirstY = 1;
+                /// @brief Last row of buckets
+                unsigned short LastY = 0;
+                /// @brief First column of buckets
+                unsigned short FirstX = 1;
+                /// @brief Last column of buckets
+                unsigned short LastX = 0;
+
+                /// @brief Check whether a bucket is in the span
+                /// @param by Row of the bucket
+                /// @param bx Column of the bucket
+                /// @returns True if the bucket is in the span
+                bool contains(unsigned short by, unsigned short bx) const {return by >= FirstY && by <= LastY && bx >= FirstX && bx <= LastX;}
+            };
+
+            /// @brief Height (rows) of the area covered by the buckets
+            unsigned short DimY;
+            /// @brief Length (cols) of the area covered by the buckets
+            unsigned short DimX;
+            /// @brief Height and length (in cells) of each bucket
+            unsigned char BucketDim;
+            /// @brief Amount of buckets in each row of buckets
+            unsigned short BucketsX;
+
+            /// @brief Every region (an ID is its index), including unused slots
+            std::vector<Region> Regions;
+            /// @brief IDs of slots that are free to be reused
+            std::vector<unsigned int> Free;
+            /// @brief IDs of the regions that overlap each bucket (row-major)
+            std::vector<std::vector<unsigned int>> Buckets;
+            /// @brief Counter handed out as each region's Order
+            unsigned long NextOrder = 0;
+
+            /// @brief Get Span - Get the buckets that a region overlaps
+            /// @param region The region
+            /// @returns The buckets overlapped by the part of the region that lies within the map
+            Span gspan(const Region &region);
+            /// @brief Link - Add or remove a region from the buckets of a span
+            /// @param id ID of the region
+            /// @param insert Whether to add the region (true) or remove it (false)
+            /// @param span Buckets to add the region to or remove it from
+            /// @param skip Buckets within the span to leave alone (an empty span to touch all of them)
+            void link(unsigned int id, bool insert, const Span &span, const Span &skip);
+
+        public:
+            /// @brief Create a hit map covering an area of the screen
+            /// @param dimy Height (rows) of the area, most likely the screen's
+            /// @param dimx Length (cols) of the area, most likely the screen's
+            /// @param bucketDim Height and length (in cells) of each bucket (smaller = less regions to check per lookup, more buckets to touch per update)
+            HitMap(unsigned short dimy, unsigned short dimx, unsigned char bucketDim = 8);
+
+            /// @brief Add - Add a clickable region
+            /// @param y y-position (row) of the top-left corner, in screen coordinates (the same as the mouse's)
+            /// @param x x-position (col) of the top-left corner, in screen coordinates (the same as the mouse's)
+            /// @param dimy Height (rows) of the region
+            /// @param dimx Length (cols) of the region
+            /// @param z Regions with a higher z are on top of ones with a lower z
+            /// @returns The region's ID
+            unsigned int add(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, int z = 0);
+            /// @brief Remove - Remove a region (its ID may be handed out again)
+            /// @param id ID of the region
+            /// @returns True if the region was removed, false if it didn't exist
+            bool remove(unsigned int id);
+            /// @brief Clear - Remove every region
+            void clear();
+
+            /// @brief Update Move - Move and/or resize a region (only the buckets it leaves and enters get touched)
+            /// @param id ID of the region
+            /// @param y New y-position (row) of the top-left corner
+            /// @param x New x-position (col) of the top-left corner
+            /// @param dimy New height (rows)
+            /// @param dimx New length (cols)
+            /// @returns True if the region was moved, false if it doesn't exist
+            bool umove(unsigned int id, unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx);
+            /// @brief Update Z - Change a region's z-order (it also goes on top of other regions with the same z)
+            /// @param id ID of the region
+            /// @param z New z-order
+            /// @returns True if the region was changed, false if it doesn't exist
+            bool uz(unsigned int id, int z);
+
+            /// @brief Get Hit - Find the top-most region under a position
+            /// @param y y-position (row), in screen coordinates
+            /// @param x x-position (col), in screen coordinates
+            /// @returns The region's ID, -1 if there isn't a region there
+            long ghit(unsigned short y, unsigned short x);
+            /// @brief Get Count - Get the amount of regions
+            /// @returns The amount of regions
+            const unsigned int gcount();
+    };
+}
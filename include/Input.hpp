@@ -0,0 +1,140 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    /// @brief A single decoded key or mouse input
+    struct Event {
+        /// @brief Character (unicode friendly) or ncurses KEY_* code, KEY_MOUSE for mouse inputs
+        int Key = ERR;
+        /// @brief Mouse button/input (one of the M* defines) if Key is KEY_MOUSE
+        char Button = M_UNKNOWN;
+        /// @brief y-position (row) of the mouse cursor if Key is KEY_MOUSE
+        unsigned short Y = 0;
+        /// @brief x-position (col) of the mouse cursor if Key is KEY_MOUSE
+        unsigned short X = 0;
+    };
+
+    /// @brief Bounded single-producer/single-consumer queue that never locks (one thread may only push, one other thread may only pop)
+    /// @tparam T Type of the items
+    /// @tparam N Capacity (must be a power of two)
+    template <typename T, std::size_t N>
+    class Queue {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "Queue capacity must be a power of two");
+
+        private:
+            /// @brief Ring buffer that the items live in
+            T Items[N];
+            /// @brief Index of the next item to pop (only ever written by the consumer), kept on its own cache line
+            alignas(64) std::atomic<std::size_t> Head{0};
+            /// @brief Index of the next slot to push into (only ever written by the producer), kept on its own cache line
+            alignas(64) std::atomic<std::size_t> Tail{0};
+
+        public:
+            /// @brief Push - Add an item to the back of the queue (producer only)
+            /// @param item Item to add
+            /// @returns True if the item was added, false if the queue was full
+            bool push(const T &item) {
+                std::size_t tail = Tail.load(std::memory_order_relaxed);
+                if (tail - Head.load(std::memory_order_acquire) == N) {return false;}
+
+                Items[tail & (N - 1)] = item;
+                Tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+            /// @brief Pop - Take an item from the front of the queue (consumer only)
+            /// @param item Set to the item that was taken
+            /// @returns True if an item was taken, false if the queue was empty
+            bool pop(T &item) {
+                std::size_t head = Head.load(std::memory_order_relaxed);
+                if (head == Tail.load(std::memory_order_acquire)) {return false;}
+
+                item = Items[head & (N - 1)];
+                Head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+            /// @brief Get Size - Get the amount of items in the queue (only a snapshot while the other thread is running)
+            /// @returns The amount of items in the queue
+            const std::size_t gsize() {return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire);}
+    };
+
+    /// @brief Opt-in input subsystem - reads and decodes keys and mouse inputs from stdin on its own thread so that rendering and input never hold each other up
+    class Input {
+        private:
+            /// @brief Decoded inputs waiting for the UI thread
+            Queue<Event, 1024> Events;
+            /// @brief Thread that reads and decodes the input
+            std::thread Reader;
+            /// @brief Whether the reader thread should keep going
+            std::atomic<bool> Running{false};
+            /// @brief Amount of inputs thrown away because the queue was full
+            std::atomic<unsigned long> Dropped{0};
+
+            /// @brief File descriptor that input gets read from
+            int Fd = STDIN_FILENO;
+            /// @brief Pipe used to wake the reader thread up when stopping (read end, write end)
+            int Wake[2] = {-1, -1};
+            /// @brief Pipe that the reader thread pokes after queueing up inputs (or ending) so the UI thread can sleep until there are some (read end, write end; both non-blocking)
+            int Notify[2] = {-1, -1};
+            /// @brief Whether SGR mouse reporting was turned on by start()
+            bool UseMouse = false;
+            /// @brief Byte that the terminal sends for Backspace (from its terminfo entry), -1 if there isn't a single one
+            int Backspace = -1;
+            /// @brief Mouse button that was last pressed (X10 mouse reports don't say which button was released)
+            char LastButton = M1_PRESS;
+
+            /// @brief Read - Loop run by the reader thread
+            void read();
+            /// @brief Decode - Decode a single input from raw terminal bytes
+            /// @param buffer Bytes to decode from
+            /// @param length Amount of bytes in the buffer
+            /// @param event Set to the decoded input (Key is left as ERR for sequences that aren't understood)
+            /// @returns The amount of bytes used up, 0 if the bytes are only the start of an input
+            std::size_t decode(const unsigned char *buffer, std::size_t length, Event &event);
+            /// @brief Decode Mouse - Fill in an event from a mouse report
+            /// @param button Button code from the report
+            /// @param y y-position (row) from the report (1-based)
+            /// @param x x-position (col) from the report (1-based)
+            /// @param release Whether the report is for a release (SGR reports say so separately from the button code)
+            /// @param event Event to fill in
+            void decodeMouse(unsigned int button, unsigned int y, unsigned int x, bool release, Event &event);
+
+        public:
+            /// @brief Stop the reader thread (if it's running) along with the Input
+            ~Input();
+
+            /// @brief Start - Start reading input on its own thread (gchar() and the wait() functions take their input from the thread until stop() is called, and gstr() can't be used in the meantime)
+            /// @param useMouse Whether to turn on SGR mouse reporting (pair with init(true))
+            /// @param fd File descriptor to read from (stdin by default; a pipe works for testing)
+            /// @returns True if the thread was started, false if it was already running or couldn't be started
+            bool start(bool useMouse = false, int fd = STDIN_FILENO);
+            /// @brief Stop - Stop reading input and wait for the reader thread to end
+            void stop();
+
+            /// @brief Get Event - Take the oldest decoded input without blocking
+            /// @param event Set to the input that was taken
+            /// @returns True if there was an input, false if not
+            bool gevent(Event &event);
+            /// @brief Get Event (Waiting) - Take the oldest decoded input, sleeping until there is one or the time runs out
+            /// @param event Set to the input that was taken
+            /// @param millis Most milliseconds to wait for (-1 to wait for as long as the reader thread is running)
+            /// @returns True if there was an input, false if the time ran out (or the reader thread ended) first
+            bool gevent(Event &event, int millis);
+            /// @brief Drain - Take a batch of decoded inputs without blocking
+            /// @param events Vector that the inputs get appended to
+            /// @param max Most inputs to take
+            /// @param coalesce Whether to only keep the latest mouse motion of the batch (see Mouse::coalesce())
+            /// @returns The amount of inputs appended
+            std::size_t drain(std::vector<Event> &events, std::size_t max = 256, bool coalesce = true);
+
+            /// @brief Get Running - Get whether the reader thread is running
+            /// @returns True if the reader thread is running, false if not
+            const bool grunning();
+            /// @brief Get Dropped - Get the amount of inputs thrown away because the UI thread wasn't draining them fast enough
+            /// @returns The amount of inputs dropped
+            const unsigned long gdropped();
+    };
+
+    /// @brief The input subsystem (only used once started)
+    extern Input minput;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    /// @brief A unicode box drawing character and the directions/styles that make it up
+    struct LinePiece {
+        /// @brief The box drawing character
+        wchar_t Char;
+        /// @brief Connection style (STYLE_*) going up, down, left and right
+        unsigned char Dirs[4];
+    };
+
+    /// @brief Every box drawing character that lines can be made of, in the order that getPiece() picks variants by
+    constexpr LinePiece LinePieces[] = {
+        // Horizontal and vertical lines off all 6 dash styles (none, single 1, single 2, double, triple, quadruple)
+        {L'─', {0, 0, 1, 1}}, {L'╌', {0, 0, 1, 1}}, {L'┄', {0, 0, 1, 1}}, {L'┈', {0, 0, 1, 1}}, {L'╴', {0, 0, 1, 1}}, {L'╶', {0, 0, 1, 1}},
+        {L'━', {0, 0, 2, 2}}, {L'╍', {0, 0, 2, 2}}, {L'┅', {0, 0, 2, 2}}, {L'┉', {0, 0, 2, 2}}, {L'╸', {0, 0, 2, 2}}, {L'╺', {0, 0, 2, 2}},
+        {L'│', {1, 1, 0, 0}}, {L'╎', {1, 1, 0, 0}}, {L'┆', {1, 1, 0, 0}}, {L'┊', {1, 1, 0, 0}}, {L'╵', {1, 1, 0, 0}}, {L'╷', {1, 1, 0, 0}},
+        {L'┃', {2, 2, 0, 0}}, {L'╏', {2, 2, 0, 0}}, {L'┇', {2, 2, 0, 0}}, {L'┋', {2, 2, 0, 0}}, {L'╹', {2, 2, 0, 0}}, {L'╻', {2, 2, 0, 0}},
+        {L'═', {0, 0, 3, 3}}, {L'║', {3, 3, 0, 0}},
+        // Corners
+        {L'┌', {0, 1, 0, 1}}, {L'╭', {0, 1, 0, 1}}, {L'┐', {0, 1, 1, 0}}, {L'╮', {0, 1, 1, 0}}, {L'└', {1, 0, 0, 1}}, {L'╰', {1, 0, 0, 1}}, {L'┘', {1, 0, 1, 0}}, {L'╯', {1, 0, 1, 0}},
+        {L'┍', {0, 1, 0, 2}}, {L'┎', {0, 2, 0, 1}}, {L'┏', {0, 2, 0, 2}}, {L'╒', {0, 1, 0, 3}}, {L'╓', {0, 3, 0, 1}}, {L'╔', {0, 3, 0, 3}},
+        {L'┑', {0, 1, 2, 0}}, {L'┒', {0, 2, 1, 0}}, {L'┓', {0, 2, 2, 0}}, {L'╕', {0, 1, 3, 0}}, {L'╖', {0, 3, 1, 0}}, {L'╗', {0, 3, 3, 0}},
+        {L'┕', {1, 0, 0, 2}}, {L'┖', {2, 0, 0, 1}}, {L'┗', {2, 0, 0, 2}}, {L'╘', {1, 0, 0, 3}}, {L'╙', {3, 0, 0, 1}}, {L'╚', {3, 0, 0, 3}},
+        {L'┙', {1, 0, 2, 0}}, {L'┚', {2, 0, 1, 0}}, {L'┛', {2, 0, 2, 0}}, {L'╛', {1, 0, 3, 0}}, {L'╜', {3, 0, 1, 0}}, {L'╝', {3, 0, 3, 0}},
+        // Tees
+        {L'├', {1, 1, 0, 1}}, {L'┝', {1, 1, 0, 2}}, {L'┞', {2, 1, 0, 1}}, {L'┟', {1, 2, 0, 1}}, {L'┠', {2, 2, 0, 1}}, {L'┡', {2, 1, 0, 2}}, {L'┢', {1, 2, 0, 2}}, {L'┣', {2, 2, 0, 2}}, {L'╞', {1, 1, 0, 3}}, {L'╟', {3, 3, 0, 1}}, {L'╠', {3, 3, 0, 3}},
+        {L'┤', {1, 1, 1, 0}}, {L'┥', {1, 1, 2, 0}}, {L'┦', {2, 1, 1, 0}}, {L'┧', {1, 2, 1, 0}}, {L'┨', {2, 2, 1, 0}}, {L'┩', {2, 1, 2, 0}}, {L'┪', {1, 2, 2, 0}}, {L'┫', {2, 2, 2, 0}}, {L'╡', {1, 1, 3, 0}}, {L'╢', {3, 3, 1, 0}}, {L'╣', {3, 3, 3, 0}},
+        {L'┬', {0, 1, 1, 1}}, {L'┭', {0, 1, 2, 1}}, {L'┮', {0, 1, 1, 2}}, {L'┯', {0, 1, 2, 2}}, {L'┰', {0, 2, 1, 1}}, {L'┱', {0, 2, 2, 1}}, {L'┲', {0, 2, 1, 2}}, {L'┳', {0, 2, 2, 2}}, {L'╤', {0, 1, 3, 3}}, {L'╥', {0, 3, 1, 1}}, {L'╦', {0, 3, 3, 3}},
+        {L'┴', {1, 0, 1, 1}}, {L'┵', {1, 0, 2, 1}}, {L'┶', {1, 0, 1, 2}}, {L'┷', {1, 0, 2, 2}}, {L'┸', {2, 0, 1, 1}}, {L'┹', {2, 0, 2, 1}}, {L'┺', {2, 0, 1, 2}}, {L'┻', {2, 0, 2, 2}}, {L'╧', {1, 0, 3, 3}}, {L'╨', {3, 0, 1, 1}}, {L'╩', {3, 0, 3, 3}},
+        // Crosses
+        {L'┼', {1, 1, 1, 1}}, {L'┽', {1, 1, 2, 1}}, {L'┾', {1, 1, 1, 2}}, {L'┿', {1, 1, 2, 2}}, {L'╀', {2, 1, 1, 1}}, {L'╁', {1, 2, 1, 1}}, {L'╂', {2, 2, 1, 1}}, {L'╃', {2, 1, 2, 1}},
+        {L'╄', {2, 1, 1, 2}}, {L'╅', {1, 2, 2, 1}}, {L'╆', {1, 2, 1, 2}}, {L'╇', {2, 2, 1, 2}}, {L'╈', {1, 2, 2, 2}}, {L'╉', {2, 2, 2, 1}}, {L'╊', {2, 2, 1, 2}}, {L'╋', {2, 2, 2, 2}},
+        {L'╪', {1, 1, 3, 3}}, {L'╫', {3, 3, 1, 1}}, {L'╬', {3, 3, 3, 3}},
+        // Thickness transitions
+        {L'╼', {0, 0, 1, 2}}, {L'╽', {1, 2, 0, 0}}, {L'╾', {0, 0, 2, 1}}, {L'╿', {2, 1, 0, 0}}
+    };
+
+    /// @brief Pack Directions - Pack the connection styles of the 4 directions into a single byte (2 bits each)
+    /// @param up Connection style (STYLE_*) going up
+    /// @param down Connection style (STYLE_*) going down
+    /// @param left Connection style (STYLE_*) going left
+    /// @param right Connection style (STYLE_*) going right
+    /// @returns The packed directions, used to index PieceTable
+    constexpr unsigned char packDirs(unsigned char up, unsigned char down, unsigned char left, unsigned char right) {return (up & 3) << 6 | (down & 3) << 4 | (left & 3) << 2 | (right & 3);}
+
+    /// @brief Every (directions, box style, dash style) combination mapped to the box drawing character that gets drawn for it, built at compile time
+    class PieceTable {
+        private:
+            /// @brief Index into LinePieces of the first piece made up of each set of packed directions (255 if there is none)
+            unsigned char First[256] = {};
+            /// @brief The piece for each box style, dash style and set of packed directions (L' ' if there is none)
+            wchar_t Pieces[8][6][256] = {};
+            /// @brief The packed directions that make up each character of the box drawing block (U+2500-U+257F), 0 for the ones lines aren't made of
+            unsigned char Connects[128] = {};
+
+            /// @brief Find - Pick the variant of the piece made up of a set of directions that fits a style
+            /// @param dirs Packed directions
+            /// @param style Box style (LIGHT_HARD, HEAVY_BOTH, etc.)
+            /// @param dash Dash style (DASHED_NONE, DASHED_DOUBLE, etc.)
+            /// @returns The piece, L' ' if no piece is made up of the directions
+            constexpr wchar_t find(unsigned char dirs, unsigned char style, unsigned char dash) const {
+                unsigned char i = First[dirs];
+                if (i == 255) {return L' ';}
+
+                // Vertical and horizontal lines (except for the doubled styles)
+                if (i < 24) {
+                    if (style == HEAVY_HORIZONTAL) {return LinePieces[i == 18 ? 12 + dash : i + dash].Char;}
+                    else if (style == HEAVY_VERTICAL) {return LinePieces[i == 6 ? dash : i + dash].Char;}
+
+                    return LinePieces[i + dash].Char;
+                }
+                // Vertical and horizontal lines for the doubled styles (they don't have dashed variants so are on their own)
+                else if (i < 26) {
+                    if (style == DOUBLED_HORIZTONAL) {return LinePieces[i == 24 ? i : dash].Char;}
+                    else if (style == DOUBLED_VERTICAL) {return LinePieces[i == 24 ? 12 + dash : i].Char;}
+
+                    return LinePieces[i].Char;
+                }
+                // Corner pieces for the LIGHT_HARD and LIGHT_SOFT styles
+                else if (i < 33) {
+                    return LinePieces[i + (style == LIGHT_SOFT ? 1 : 0)].Char;
+                }
+
+                return LinePieces[i].Char;
+            }
+
+        public:
+            constexpr PieceTable() {
+                for (unsigned short dirs = 0; dirs < 256; dirs++) {First[dirs] = 255;}
+                for (unsigned char i = sizeof(LinePieces) / sizeof(LinePiece); i-- > 0;) {
+                    unsigned char dirs = packDirs(LinePieces[i].Dirs[0], LinePieces[i].Dirs[1], LinePieces[i].Dirs[2], LinePieces[i].Dirs[3]);
+                    First[dirs] = i;
+                    Connects[LinePieces[i].Char - 0x2500] = dirs;
+                }
+
+                for (unsigned char style = 0; style < 8; style++) {
+                    bool heavy = style == HEAVY_BOTH || style == HEAVY_HORIZONTAL || style == HEAVY_VERTICAL;
+
+                    for (unsigned char dash = 0; dash < 6; dash++) {
+                        for (unsigned short dirs = 0; dirs < 256; dirs++) {
+                            wchar_t piece = find(dirs, style, dash);
+
+                            // There are no unicode characters that properly mesh doubled and heavy lines, so the directions that don't
+                            // match the style are swapped out (heavy styles turn doubled directions heavy, the rest turn heavy ones doubled)
+                            if (piece == L' ') {
+                                unsigned char swapped = 0;
+                                for (unsigned char shift = 0; shift < 8; shift += 2) {
+                                    unsigned char dir = dirs >> shift & 3;
+                                    if (heavy) {dir = (dir == STYLE_DOUBLED) ? STYLE_HEAVY : dir;}
+                                    else {dir = (dir == STYLE_HEAVY) ? STYLE_DOUBLED : dir;}
+                                    swapped |= dir << shift;
+                                }
+
+                                piece = find(swapped, style, dash);
+                            }
+
+                            Pieces[style][dash][dirs] = piece;
+                        }
+                    }
+                }
+            }
+
+            /// @brief Get Piece - Get the box drawing character for a set of directions
+            /// @param dirs Directions packed with packDirs()
+            /// @param style Box style (LIGHT_HARD, HEAVY_BOTH, etc.), must be below 8
+            /// @param dash Dash style (DASHED_NONE, DASHED_DOUBLE, etc.), must be below 6
+            /// @returns The box drawing character, L' ' if none fit
+            constexpr wchar_t gpiece(unsigned char dirs, unsigned char style, unsigned char dash) const {return Pieces[style][dash][dirs];}
+            /// @brief Get Directions - Get the directions that a character connects to other lines in
+            /// @param ch Character to check
+            /// @returns The packed directions, 0 if the character isn't a piece of a line (anything outside of U+2500-U+257F is rejected right away)
+            constexpr unsigned char gdirs(wchar_t ch) const {return ((unsigned int)ch - 0x2500 < 128) ? Connects[ch - 0x2500] : 0;}
+    };
+
+    /// @brief The lookup table that line drawing picks pieces from
+    extern const PieceTable mpieces;
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "General.hpp"
+
+/// @brief The glyph exists in the matrix font
+#define GLYPH_DEFINED 1
+/// @brief The glyph hangs one row below the baseline (g, j, p, q, y)
+#define GLYPH_DESCENDER 2
+/// @brief The glyph has a dot that sits above its 3x3 block (j)
+#define GLYPH_DOT 4
+
+namespace npp {
+    /// @brief A character of the 6x6 matrix font and the 3x3 set of unicode box element characters that it's drawn with
+    struct MatrixSource {
+        /// @brief The regular character
+        char Char;
+        /// @brief The box element characters (row by row)
+        wchar_t Cells[3][3];
+    };
+
+    /// @brief The key that matches a 3x3 set of unicode box element characters to the regular character they represent
+    constexpr MatrixSource MatrixText6x6[] = {
+        {' ', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L' ', L' '}}},
+        {'a', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}}},
+        {'b', {{L'▌', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▛', L'▄', L'▞'}}},
+        {'c', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▀'}, {L'▚', L'▄', L'▄'}}},
+        {'d', {{L' ', L' ', L'▐'}, {L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}}},
+        {'e', {{L' ', L' ', L' '}, {L'▟', L'█', L'▙'}, {L'▚', L'▄', L'▄'}}},
+        {'f', {{L' ', L'▞', L'▖'}, {L'▗', L'▙', L'▖'}, {L' ', L'▌', L' '}}},
+        {'g', {{L'▞', L'▀', L'▟'}, {L'▚', L'▄', L'▜'}, {L'▗', L'▄', L'▞'}}},
+        {'h', {{L'▌', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▌', L' ', L'▐'}}},
+        {'i', {{L' ', L'▘', L' '}, {L' ', L'▌', L' '}, {L' ', L'▚', L' '}}},
+        {'j', {{L' ', L'▝', L' '}, {L' ', L'▐', L' '}, {L'▝', L'▞', L' '}}},
+        {'k', {{L'▌', L' ', L' '}, {L'▙', L'▄', L'▘'}, {L'▌', L' ', L'▌'}}},
+        {'l', {{L' ', L'▌', L' '}, {L' ', L'▌', L' '}, {L' ', L'▚', L' '}}},
+        {'m', {{L' ', L' ', L' '}, {L'▛', L'▞', L'▖'}, {L'▌', L'▌', L'▌'}}},
+        {'n', {{L' ', L' ', L' '}, {L'▛', L'▀', L'▚'}, {L'▌', L' ', L'▐'}}},
+        {'o', {{L' ', L' ', L' '}, {L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'p', {{L'▞', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L' '}}},
+        {'q', {{L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▟'}, {L' ', L' ', L'▐'}}},
+        {'r', {{L' ', L' ', L' '}, {L'▙', L'▀', L'▚'}, {L'▌', L' ', L' '}}},
+        {'s', {{L'▗', L'▄', L'▖'}, {L'▚', L'▄', L'▖'}, {L'▗', L'▄', L'▞'}}},
+        {'t', {{L' ', L'▌', L' '}, {L'▀', L'▛', L'▀'}, {L' ', L'▚', L' '}}},
+        {'u', {{L' ', L' ', L' '}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▟'}}},
+        {'v', {{L' ', L' ', L' '}, {L'▌', L' ', L'▐'}, {L'▝', L'▄', L'▘'}}},
+        {'w', {{L' ', L' ', L' '}, {L'▐', L'▐', L'▐'}, {L'▝', L'▞', L'▟'}}},
+        {'x', {{L' ', L' ', L' '}, {L'▝', L'▄', L'▘'}, {L'▗', L'▀', L'▖'}}},
+        {'y', {{L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▟'}, {L'▗', L'▄', L'▞'}}},
+        {'z', {{L'▄', L'▄', L'▄'}, {L'▗', L'▄', L'▞'}, {L'▙', L'▄', L'▄'}}},
+        {'A', {{L'▞', L'▀', L'▚'}, {L'▙', L'▄', L'▟'}, {L'▌', L' ', L'▐'}}},
+        {'B', {{L'▛', L'▀', L'▚'}, {L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}}},
+        {'C', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L' '}, {L'▚', L'▄', L'▞'}}},
+        {'D', {{L'▛', L'▀', L'▚'}, {L'▌', L' ', L'▐'}, {L'▙', L'▄', L'▞'}}},
+        {'E', {{L'▛', L'▀', L'▀'}, {L'▛', L'▀', L'▀'}, {L'▙', L'▄', L'▄'}}},
+        {'F', {{L'▛', L'▀', L'▀'}, {L'▛', L'▀', L'▀'}, {L'▌', L' ', L' '}}},
+        {'G', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L'▄'}, {L'▚', L'▄', L'▟'}}},
+        {'H', {{L'▌', L' ', L'▐'}, {L'▛', L'▀', L'▜'}, {L'▌', L' ', L'▐'}}},
+        {'I', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L'▄', L'▟', L'▄'}}},
+        {'J', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L'▚', L'▟', L' '}}},
+        {'K', {{L'▌', L' ', L'▞'}, {L'▛', L'▀', L'▖'}, {L'▌', L' ', L'▐'}}},
+        {'L', {{L'▌', L' ', L' '}, {L'▌', L' ', L' '}, {L'▙', L'▄', L'▄'}}},
+        {'M', {{L'▙', L' ', L'▟'}, {L'▌', L'▀', L'▐'}, {L'▌', L' ', L'▐'}}},
+        {'N', {{L'▙', L' ', L'▐'}, {L'▌', L'▚', L'▐'}, {L'▌', L' ', L'▜'}}},
+        {'O', {{L'▞', L'▀', L'▚'}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▞'}}},
+        {'P', {{L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L' '}}},
+        {'Q', {{L'▞', L'▀', L'▚'}, {L'▌', L'▗', L'▐'}, {L'▚', L'▄', L'▚'}}},
+        {'R', {{L'▛', L'▀', L'▚'}, {L'▙', L'▄', L'▞'}, {L'▌', L' ', L'▐'}}},
+        {'S', {{L'▞', L'▀', L'▘'}, {L'▝', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'T', {{L'▀', L'▜', L'▀'}, {L' ', L'▐', L' '}, {L' ', L'▐', L' '}}},
+        {'U', {{L'▌', L' ', L'▐'}, {L'▌', L' ', L'▐'}, {L'▚', L'▄', L'▞'}}},
+        {'V', {{L'▌', L' ', L'▐'}, {L'▚', L' ', L'▞'}, {L'▝', L'▄', L'▘'}}},
+        {'W', {{L'▌', L' ', L'▐'}, {L'▌', L'▄', L'▐'}, {L'▛', L' ', L'▜'}}},
+        {'X', {{L'▚', L' ', L'▞'}, {L' ', L'█', L' '}, {L'▞', L' ', L'▚'}}},
+        {'Y', {{L'▌', L' ', L'▐'}, {L'▝', L'▄', L'▘'}, {L' ', L'█', L' '}}},
+        {'Z', {{L'▀', L'▀', L'▜'}, {L'▗', L'▞', L'▘'}, {L'▙', L'▄', L'▄'}}},
+        {'0', {{L'▞', L'▀', L'▙'}, {L'▌', L'▞', L'▐'}, {L'▜', L'▄', L'▞'}}},
+        {'1', {{L' ', L'▟', L' '}, {L' ', L'▐', L' '}, {L' ', L'▟', L'▖'}}},
+        {'2', {{L'▞', L'▀', L'▚'}, {L' ', L'▗', L'▞'}, {L'▟', L'▙', L'▄'}}},
+        {'3', {{L'▞', L'▀', L'▚'}, {L' ', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'4', {{L'▌', L' ', L'▌'}, {L'▝', L'▀', L'▛'}, {L' ', L' ', L'▌'}}},
+        {'5', {{L'▛', L'▀', L'▀'}, {L'▀', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'6', {{L'▞', L'▀', L'▀'}, {L'▛', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'7', {{L'▀', L'▀', L'▜'}, {L' ', L'▗', L'▘'}, {L' ', L'▌', L' '}}},
+        {'8', {{L'▞', L'▀', L'▚'}, {L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▞'}}},
+        {'9', {{L'▞', L'▀', L'▚'}, {L'▚', L'▄', L'▟'}, {L'▗', L'▄', L'▟'}}},
+        {'`', {{L'▗', L' ', L' '}, {L' ', L'▘', L' '}, {L' ', L' ', L' '}}},
+        {'~', {{L'▗', L'▖', L'▗'}, {L'▘', L'▝', L'▘'}, {L' ', L' ', L' '}}},
+        {'!', {{L' ', L'█', L' '}, {L' ', L'█', L' '}, {L' ', L'▄', L' '}}},
+        {'@', {{L'▞', L'▀', L'▚'}, {L'▌', L'█', L'▟'}, {L'▚', L'▄', L'▄'}}},
+        {'#', {{L'▟', L'▄', L'▙'}, {L'▐', L' ', L'▌'}, {L'▜', L'▀', L'▛'}}},
+        {'$', {{L'▗', L'▙', L'▖'}, {L'▚', L'▙', L'▖'}, {L'▗', L'▙', L'▞'}}},
+        {'%', {{L'█', L' ', L'▞'}, {L' ', L'▞', L' '}, {L'▞', L' ', L'█'}}},
+        {'^', {{L' ', L'▄', L' '}, {L'▝', L' ', L'▘'}, {L' ', L' ', L' '}}},
+        {'&', {{L'▞', L'▚', L' '}, {L'▞', L'▌', L'▖'}, {L'▚', L'▞', L'▖'}}},
+        {'*', {{L'▝', L'▄', L'▘'}, {L'▗', L'▀', L'▖'}, {L' ', L' ', L' '}}},
+        {'(', {{L' ', L'▞', L'▘'}, {L'▐', L' ', L' '}, {L' ', L'▚', L'▖'}}},
+        {')', {{L'▝', L'▚', L' '}, {L' ', L' ', L'▌'}, {L'▗', L'▞', L' '}}},
+        {'-', {{L' ', L' ', L' '}, {L'▗', L'▄', L'▖'}, {L' ', L' ', L' '}}},
+        {'_', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L'▄', L'▄', L'▄'}}},
+        {'=', {{L' ', L' ', L' '}, {L'▄', L'█', L'▄'}, {L' ', L'▀', L' '}}},
+        {'+', {{L' ', L' ', L' '}, {L'▝', L'▀', L'▘'}, {L'▝', L'▀', L'▘'}}},
+        {'[', {{L'▐', L'▀', L'▘'}, {L'▐', L' ', L' '}, {L'▐', L'▄', L'▖'}}},
+        {'{', {{L' ', L'▛', L'▘'}, {L'█', L' ', L' '}, {L' ', L'▙', L'▖'}}},
+        {']', {{L'▝', L'▀', L'▌'}, {L' ', L' ', L'▌'}, {L'▗', L'▄', L'▌'}}},
+        {'}', {{L'▝', L'▜', L' '}, {L' ', L' ', L'█'}, {L'▗', L'▟', L' '}}},
+        {'\\', {{L' ', L'█', L' '}, {L' ', L'█', L' '}, {L' ', L'█', L' '}}},
+        {'|', {{L'▚', L' ', L' '}, {L' ', L'▚', L' '}, {L' ', L' ', L'▚'}}},
+        {';', {{L' ', L' ', L' '}, {L' ', L'▀', L' '}, {L' ', L'▜', L' '}}},
+        {':', {{L' ', L' ', L' '}, {L' ', L'▀', L' '}, {L' ', L'▄', L' '}}},
+        {'\'', {{L' ', L'▗', L'▖'}, {L' ', L' ', L'▘'}, {L' ', L' ', L' '}}},
+        {'"', {{L'▗', L' ', L'▖'}, {L'▝', L' ', L'▘'}, {L' ', L' ', L' '}}},
+        {',', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L'▜', L' '}}},
+        {'<', {{L' ', L'▗', L'▖'}, {L'▐', L'▌', L' '}, {L' ', L'▝', L'▘'}}},
+        {'.', {{L' ', L' ', L' '}, {L' ', L' ', L' '}, {L' ', L'▄', L' '}}},
+        {'>', {{L'▗', L'▖', L' '}, {L' ', L'▐', L'▌'}, {L'▝', L'▘', L' '}}},
+        {'?', {{L'▞', L'▀', L'▚'}, {L' ', L'▄', L'▘'}, {L' ', L'▄', L' '}}},
+        {'/', {{L' ', L' ', L'▞'}, {L' ', L'▞', L' '}, {L'▞', L' ', L' '}}}
+    };
+
+    /// @brief A glyph of the matrix font, ready to be copied into a window
+    struct MatrixGlyph {
+        /// @brief The box element characters (row by row)
+        wchar_t Cells[3][3] = {};
+        /// @brief Set of GLYPH_* bits
+        unsigned char Flags = 0;
+    };
+
+    /// @brief The matrix font as an atlas that's indexed directly by ASCII character, built at compile time
+    class MatrixFont {
+        private:
+            /// @brief The glyph of each ASCII character (Flags is 0 for characters the font doesn't have)
+            MatrixGlyph Glyphs[128] = {};
+
+        public:
+            constexpr MatrixFont() {
+                for (unsigned char i = sizeof(MatrixText6x6) / sizeof(MatrixSource); i-- > 0;) {
+                    MatrixGlyph &glyph = Glyphs[(unsigned char)MatrixText6x6[i].Char];
+                    char ch = MatrixText6x6[i].Char;
+
+                    for (unsigned char k = 0; k < 3; k++) {
+                        for (unsigned char l = 0; l < 3; l++) {glyph.Cells[k][l] = MatrixText6x6[i].Cells[k][l];}
+                    }
+
+                    glyph.Flags = GLYPH_DEFINED;
+                    if (ch == 'g' || ch == 'j' || ch == 'p' || ch == 'q' || ch == 'y') {glyph.Flags |= GLYPH_DESCENDER;}
+                    if (ch == 'j') {glyph.Flags |= GLYPH_DOT;}
+                }
+            }
+
+            /// @brief Get Glyph - Get the glyph of a character
+            /// @param ch Character to get the glyph of
+            /// @returns The glyph (with Flags set to 0 if the font doesn't have the character)
+            constexpr const MatrixGlyph &gglyph(char ch) const {return Glyphs[((unsigned char)ch < 128) ? (unsigned char)ch : 0];}
+    };
+
+    /// @brief The atlas that matrix text is drawn from
+    extern const MatrixFont mmatrix;
+}
@@ -4,6 +4,8 @@
 #include "Window.hpp"
 
 namespace npp {
+    struct Event;
+
     /// @brief Essentially the same as the MEVENT from ncurses, but with friendlier values
     class Mouse {
         private:
@@ -16,6 +18,14 @@ namespace npp {
             /// @brief z-position (???) of the mouse cursor during the last event
             unsigned short Z = 0;
 
+            /// @brief ncurses window that last read a KEY_MOUSE through gchar() or the wait() functions (queued motion gets read through it)
+            WINDOW *Source = nullptr;
+
+            /// @brief Amount of mouse events that came in from the terminal
+            unsigned long Raw = 0;
+            /// @brief Amount of mouse events that were actually handed to the program (the rest were motion that got coalesced)
+            unsigned long Delivered = 0;
+
         public:
             /// @brief Get Input - Get the mouse's last recorded input
             /// @returns A number corresponding to the mouse's last recorded input
@@ -29,10 +39,34 @@ namespace npp {
             /// @brief Get Z - Get the mouse's last recorded z-position (???)
             /// @returns The mouse's last recorded z-position (???)
             const unsigned short gz();
+            /// @brief Get Raw - Get the amount of mouse events that came in from the terminal
+            /// @returns The amount of raw mouse events
+            const unsigned long graw();
+            /// @brief Get Delivered - Get the amount of mouse events that were handed to the program after motion was coalesced
+            /// @returns The amount of delivered mouse events
+            const unsigned long gdelivered();
 
-            /// @brief Get Mouse - Take an input from gchar() or something and update the mouse
+            /// @brief Get Mouse - Take an input from gchar() or something and update the mouse (while minput's thread is running, gchar() has already done so and this only checks for KEY_MOUSE)
             /// @param input Integer input (most likely from gchar())
+            /// @param win ncurses window that the input was read through (the window that last read a KEY_MOUSE through gchar() or the wait() functions if left out)
             /// @returns True if the Mouse was successfully updated, false if not
-            bool gmouse(int input);
-    } mmouse;
+            bool gmouse(int input, WINDOW *win = nullptr);
+            /// @brief Get Mouse - Update the mouse from an input decoded by the input thread (minput)
+            /// @param event Event from minput.gevent() or minput.drain()
+            /// @returns True if the Mouse was updated, false if the event wasn't a mouse input
+            bool gmouse(const Event &event);
+
+            /// @brief Update Source - Remember which ncurses window read a KEY_MOUSE, so that gmouse() reads the motion queued behind it through the same window
+            /// @param win ncurses window that read the input
+            void usource(WINDOW *win);
+
+            /// @brief Coalesce - Throw away every motion event in a batch except for the latest one (presses, releases and scrolls are kept in order)
+            /// @param events Batch of events, most likely from minput.drain()
+            /// @param start Index of the first event in the batch to look at
+            /// @returns The amount of events that were thrown away
+            std::size_t coalesce(std::vector<Event> &events, std::size_t start = 0);
+    };
+
+    /// @brief The mouse
+    extern Mouse mmouse;
 }
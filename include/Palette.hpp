@@ -0,0 +1,114 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    /// @brief Everything about how a cell looks apart from its character
+    struct Look {
+        /// @brief Color pair
+        unsigned char Color = 1;
+        /// @brief Set of ATTR_* bits
+        unsigned short Attr = 0;
+        /// @brief 24-bit foreground color (RGB_SET | 0xRRGGBB) that overrides the color pair's foreground, 0 if unused
+        unsigned int Fg = 0;
+        /// @brief 24-bit background color (RGB_SET | 0xRRGGBB) that overrides the color pair's background, 0 if unused
+        unsigned int Bg = 0;
+
+        /// @brief Compare two looks
+        /// @param other Look to compare with
+        /// @returns True if both looks are the same
+        bool operator==(const Look &other) const {return Color == other.Color && Attr == other.Attr && Fg == other.Fg && Bg == other.Bg;}
+    };
+
+    /// @brief Interned style table - gives every distinct look a small ID so that cells only have to store the ID, and keeps the ncurses attributes/pair of each look ready to go
+    /// (bit 0 of an ID is the cell's merge flag, so IDs that only differ in it look the same: compare IDs >> 1 for looks)
+    class Palette {
+        private:
+            /// @brief A look along with what ncurses needs to draw it
+            struct Entry {
+                /// @brief The look itself
+                Look Key;
+                /// @brief ncurses attribute bits of the look
+                attr_t Attrs = A_NORMAL;
+                /// @brief ncurses color pair of the look, -1 until it's first needed
+                int Pair = -1;
+                /// @brief Frame that Pair was last looked up from ncurses in (pairs from alloc_pair() can be recycled or changed with init_pair() later on, so they don't stay good forever)
+                unsigned long Checked = 0;
+                /// @brief Whether the entry holds a look (collected entries wait in Free to be given to a new one)
+                bool Live = true;
+            };
+            /// @brief Hashes a look for the index
+            struct Hash {
+                std::size_t operator()(const Look &look) const {return std::hash<unsigned long long>()(((unsigned long long)look.Fg << 32 | look.Bg) ^ ((unsigned long long)look.Color << 16 | look.Attr) * 0x9E3779B97F4A7C15ULL);}
+            };
+
+            /// @brief Every interned look (the entry of an ID is at ID >> 1)
+            std::vector<Entry> Entries;
+            /// @brief Lookup from a look to its index in Entries
+            std::unordered_map<Look, unsigned int, Hash> Index;
+            /// @brief Indices in Entries that were collected and can be reused
+            std::vector<unsigned int> Free;
+            /// @brief Which entries were marked as in use since the last collection (same length as Entries)
+            std::vector<bool> Used;
+            /// @brief Amount of live looks that the palette can hold before the unused ones should be collected (doubles whenever a collection can't get it below half of this)
+            unsigned int Limit = 4096;
+            /// @brief Look that was interned last (writing the same look over and over is the common case)
+            Look LastLook;
+            /// @brief Index of the look that was interned last
+            unsigned int LastIndex = 0;
+            /// @brief Counts up every frame (a pair from alloc_pair() is only looked up from ncurses once per frame)
+            unsigned long Frame = 1;
+
+        public:
+            /// @brief Create a palette with the default look (pair 1, no attributes) as ID 0
+            Palette();
+
+            /// @brief Intern - Get the ID of a look, adding it to the palette if it's new
+            /// @param color Color pair
+            /// @param attr Set of ATTR_* bits
+            /// @param fg 24-bit foreground made with rgb(), 0 to use the color pair's
+            /// @param bg 24-bit background made with rgb(), 0 to use the color pair's
+            /// @param canMerge Whether a line drawing character with this style can be merged with
+            /// @returns The style ID (once the palette passes its limit, an ID that no window's cells use anymore can be given to a different look, so it shouldn't be kept anywhere else across frames)
+            unsigned int intern(unsigned char color, unsigned short attr, unsigned int fg = 0, unsigned int bg = 0, bool canMerge = false);
+
+            /// @brief Get Look - Get the look behind a style ID
+            /// @param id Style ID
+            /// @returns The look
+            const Look &glook(unsigned int id);
+            /// @brief Get Attributes - Get the ncurses attribute bits of a style ID
+            /// @param id Style ID
+            /// @returns The attribute bits (without a color pair)
+            const attr_t gattrs(unsigned int id);
+            /// @brief Get Pair - Get the ncurses color pair of a style ID (looks with 24-bit colors get a pair of the closest 256 colors from alloc_pair(), looked up again every frame in case ncurses recycled it or the look's pair was changed)
+            /// @param id Style ID
+            /// @returns An ncurses color pair number
+            const int gpair(unsigned int id);
+            /// @brief Update Frame - Start a new frame, so that the pairs from alloc_pair() get looked up from ncurses again the next time they're used
+            void uframe();
+            /// @brief Get Merge - Get the merge flag of a style ID
+            /// @param id Style ID
+            /// @returns Whether a line drawing character with this style can be merged with
+            const bool gmerge(unsigned int id);
+            /// @brief Update Merge - Get the ID of the same look with a different merge flag
+            /// @param id Style ID
+            /// @param canMerge New merge flag
+            /// @returns The new style ID
+            unsigned int umerge(unsigned int id, bool canMerge);
+            /// @brief Get Count - Get the amount of distinct looks in the palette
+            /// @returns The amount of looks
+            const unsigned int gcount();
+
+            /// @brief Get Collect - Get whether the palette has grown enough that the looks no cell uses anymore should be collected (every distinct 24-bit color gets a look, so changing colors would grow it forever otherwise)
+            /// @returns True if a collection is due
+            const bool gcollect();
+            /// @brief Update Mark - Mark a style ID as still in use for the next collection
+            /// @param id Style ID
+            void umark(unsigned int id);
+            /// @brief Update Collect - Collect every look that wasn't marked since the last collection (apart from the default look), so that its ID can be given to a new one
+            void ucollect();
+    };
+
+    /// @brief The style table every window's cells point into
+    extern Palette mpalette;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "General.hpp"
+
+namespace npp {
+    /// @brief A cell of the headless backend's simulated screen, as it was last drawn
+    struct ScreenCell {
+        /// @brief Character in the cell
+        wchar_t Char = L' ';
+        /// @brief Attributes (ATTR_* bits) the cell was drawn with
+        unsigned short Attr = 0;
+        /// @brief Foreground color the cell was drawn with (a color number, RGB_SET | 0xRRGGBB, or COLOR_UNSET)
+        unsigned int Fg = COLOR_UNSET;
+        /// @brief Background color the cell was drawn with (a color number, RGB_SET | 0xRRGGBB, or COLOR_UNSET)
+        unsigned int Bg = COLOR_UNSET;
+    };
+
+    /// @brief Native output backend - turns cells straight into VT/xterm escape sequences and flushes each frame with a single write(2), bypassing ncurses' own buffering and diffing
+    class Terminal {
+        private:
+            /// @brief Which backend windows render through (BACKEND_NCURSES, BACKEND_NATIVE or BACKEND_HEADLESS)
+            unsigned char Backend = BACKEND_NCURSES;
+            /// @brief File descriptor that frames get written to
+            int Fd = STDOUT_FILENO;
+
+            /// @brief Reusable buffer that the escape sequences of a frame are built in
+            std::string Buffer;
+
+            /// @brief Y-position (row) that the terminal's cursor is at, -1 if unknown
+            int CurY = -1;
+            /// @brief X-position (col) that the terminal's cursor is at, -1 if unknown
+            int CurX = -1;
+            /// @brief Attributes (ATTR_* bits) that the terminal is currently using
+            unsigned short CurAttr = 0;
+            /// @brief Foreground color that the terminal is currently using (a color number, RGB_SET | 0xRRGGBB, or COLOR_UNSET for the terminal's default)
+            unsigned int CurFg = 0;
+            /// @brief Background color that the terminal is currently using (a color number, RGB_SET | 0xRRGGBB, or COLOR_UNSET for the terminal's default)
+            unsigned int CurBg = 0;
+            /// @brief Whether CurAttr, CurFg and CurBg are actually known (they aren't until the first style has been emitted)
+            bool StyleKnown = false;
+
+            /// @brief Foreground of each color pair, as looked up from ncurses during the current frame
+            short PairFg[256];
+            /// @brief Background of each color pair, as looked up from ncurses during the current frame
+            short PairBg[256];
+            /// @brief Whether PairFg and PairBg hold a color pair yet (cleared every flush, so pairs changed with init_pair() show up on the next frame)
+            bool PairKnown[256] = {};
+
+            /// @brief Height (rows) of the headless backend's simulated screen
+            unsigned short ScreenY = 0;
+            /// @brief Length (cols) of the headless backend's simulated screen
+            unsigned short ScreenX = 0;
+            /// @brief The headless backend's simulated screen (row-major), updated as characters are put
+            std::vector<ScreenCell> Screen;
+            /// @brief Every byte the headless backend has "written" since the last clearCapture()
+            std::string Capture;
+
+            /// @brief Amount of bytes written by the last flush
+            unsigned long Bytes = 0;
+            /// @brief Amount of write(2) calls made by the last flush
+            unsigned long Syscalls = 0;
+
+            /// @brief Append Number - Append an unsigned number in decimal to the buffer
+            /// @param num Number to append
+            void appendNum(unsigned int num);
+            /// @brief Append Color - Append the SGR parameters that select a color
+            /// @param color A color number, RGB_SET | 0xRRGGBB, or COLOR_UNSET
+            /// @param background Whether the color is for the background or not
+            void appendColor(unsigned int color, bool background);
+            /// @brief Pair Colors - Get the colors that make up a color pair
+            /// @param color Color pair
+            /// @param fg Set to the pair's foreground (-1 for the terminal's default)
+            /// @param bg Set to the pair's background (-1 for the terminal's default)
+            void pairColors(unsigned char color, short &fg, short &bg);
+
+        public:
+            /// @brief Update Backend - Change which backend windows render through
+            /// @param backend BACKEND_NCURSES or BACKEND_NATIVE (use uheadless() for BACKEND_HEADLESS)
+            void ubackend(unsigned char backend);
+            /// @brief Update Headless - Switch to the headless backend with a blank simulated screen
+            /// @param dimy Height (rows) of the simulated screen
+            /// @param dimx Length (cols) of the simulated screen
+            void uheadless(unsigned short dimy, unsigned short dimx);
+            /// @brief Update File Descriptor - Change where frames get written to (stdout by default; a pty works for testing)
+            /// @param fd File descriptor to write to
+            void ufd(int fd);
+
+            /// @brief Get Backend - Get which backend windows render through
+            /// @returns BACKEND_NCURSES, BACKEND_NATIVE or BACKEND_HEADLESS
+            const unsigned char gbackend();
+            /// @brief Get Dimension Y - Get the height of the screen (the simulated one when headless)
+            /// @returns The height (rows) of the screen
+            const unsigned short gdimy();
+            /// @brief Get Dimension X - Get the length of the screen (the simulated one when headless)
+            /// @returns The length (cols) of the screen
+            const unsigned short gdimx();
+            /// @brief Get Bytes - Get the amount of bytes written by the last flush
+            /// @returns The amount of bytes written by the last flush
+            const unsigned long gbytes();
+            /// @brief Get Syscalls - Get the amount of write(2) calls made by the last flush
+            /// @returns The amount of write(2) calls made by the last flush
+            const unsigned long gsyscalls();
+
+            /// @brief Get Cell - Get a cell of the headless backend's simulated screen
+            /// @param y y-position (row) of the cell
+            /// @param x x-position (col) of the cell
+            /// @returns The cell as it was last drawn (a blank cell if it doesn't exist)
+            const ScreenCell gcell(unsigned short y, unsigned short x);
+            /// @brief Get Row - Get the characters of a row of the headless backend's simulated screen
+            /// @param y y-position (row) of the row
+            /// @returns The characters of the row (empty if it doesn't exist)
+            const std::wstring grow(unsigned short y);
+            /// @brief Get Capture - Get every byte the headless backend has "written" since the last clearCapture()
+            /// @returns The captured escape sequences and UTF-8 text
+            const std::string &gcapture();
+            /// @brief Clear Capture - Throw away the captured bytes (the simulated screen is kept)
+            void clearCapture();
+
+            /// @brief Move - Move the cursor (skipped if the cursor is already there)
+            /// @param y y-position (row) on the screen
+            /// @param x x-position (col) on the screen
+            void move(unsigned short y, unsigned short x);
+            /// @brief Style - Change the attributes and colors used for following characters (only the parts that actually change are sent)
+            /// @param attr Set of ATTR_* bits (ATTR_ALTCHARSET switches to the DEC line drawing character set; ATTR_PROTECT doesn't change how anything looks on a terminal, so it's ignored)
+            /// @param color Color pair
+            /// @param fg 24-bit foreground made with rgb() that overrides the pair's foreground, 0 to use the pair's
+            /// @param bg 24-bit background made with rgb() that overrides the pair's background, 0 to use the pair's
+            void style(unsigned short attr, unsigned char color, unsigned int fg = 0, unsigned int bg = 0);
+            /// @brief Put - Add a character at the cursor position (encoded as UTF-8)
+            /// @param ch Character to add
+            void put(wchar_t ch);
+
+            /// @brief Erase - Blank a span of a row on the screen with the terminal's default colors (the cursor is left at the start of the span)
+            /// @param y y-position (row) on the screen
+            /// @param x x-position (col) on the screen of the start of the span
+            /// @param length Amount of cells to blank
+            void erase(unsigned short y, unsigned short x, unsigned short length);
+
+            /// @brief Invalidate - Forget the known cursor position and style (for when something else may have written to the terminal)
+            void invalidate();
+            /// @brief Flush - Write everything in the buffer to the terminal with a single write(2) (more if the write comes up short); headless just captures it
+            void flush();
+    };
+
+    /// @brief The terminal that native output goes to
+    extern Terminal mterm;
+}
@@ -4,6 +4,30 @@
 #include "Mouse.hpp"
 
 namespace npp {
+    struct Animation;
+
+    /// @brief Statistics about the last frame that a window rendered
+    struct FrameStats {
+        /// @brief Amount of cells that were written to the terminal
+        unsigned long Cells = 0;
+        /// @brief Amount of runs (cells sharing a color and attributes) that were sent to ncurses or the native terminal
+        unsigned long Runs = 0;
+        /// @brief Amount of bytes written to the terminal (native backend only)
+        unsigned long Bytes = 0;
+        /// @brief Amount of write(2) calls made (native backend only)
+        unsigned long Syscalls = 0;
+    };
+
+    /// @brief Statistics about a window's cache of laid out matrix text
+    struct TextCacheStats {
+        /// @brief Amount of matrix strings that were copied straight from the cache
+        unsigned long Hits = 0;
+        /// @brief Amount of matrix strings that had to be laid out
+        unsigned long Misses = 0;
+        /// @brief Amount of laid out strings currently in the cache
+        unsigned long Blocks = 0;
+    };
+
     /// @brief The npp version of the WINDOW class from ncurses.h - comes with better support for unicode characters, much better line drawing capabilities, flashy rendering animations, and other fun bonuses
     class Window {
         private:
@@ -31,53 +55,139 @@ namespace npp {
             /// @brief If the user can skip wait() functions with an input
             bool CanSkip = true;
 
-            /// @brief Contain the data (character/color/attributes) for each cell
+            /// @brief Contain the data (character/style) for each cell - packed into 8 bytes
             struct Cell {
                 /// @brief Character contained in the cell
                 wchar_t Char = L' ';
 
-                /// @brief Color pair used for the cell
-                unsigned char Color = 1;
-
-                /// @brief Whether the cell is bolded or not
-                bool Bold = false;
-                /// @brief Whether the cell is italicized or not
-                bool Italic = false;
-                /// @brief Whether the cell is underlined or not
-                bool Under = false;
-                /// @brief Whether the cell is reversed (color pair) or not
-                bool Rev = false;
-                /// @brief Whether the cell blinks or not
-                bool Blink = false;
-                /// @brief Whether the cell is dim or not
-                bool Dim = false;
-                /// @brief Whether the cell is invisible or not
-                bool Invis = false;
-                /// @brief Whether the cell should stand out or not
-                bool Stand = false;
-                /// @brief Whether the cell should be protected or not
-                bool Prot = false;
-                /// @brief Whether the cell should use the alternate character set or not
-                bool Alt = false;
-
-                /// @brief If the cell is a line drawing character, whether it can be merged with or not
-                bool CanMerge = false;
+                /// @brief Style ID from mpalette (color pair, attributes, 24-bit colors, and whether a line drawing character can be merged with)
+                unsigned int Style = 0;
             };
-            std::vector<std::vector<Cell>> Grid;
+            static_assert(sizeof(Cell) == 8, "Cell is expected to be packed into 8 bytes");
+            /// @brief Cells of the window, stored contiguously row after row (DimX cells per row) - the back buffer that everything writes into
+            std::vector<Cell> Grid;
+            /// @brief Mirror of the cells that were last pushed to the terminal - the front buffer that Grid is diffed against
+            std::vector<Cell> Front;
+            /// @brief Span of columns (first and last, inclusive) in each row that have changed since the last render
+            std::vector<std::pair<unsigned short, unsigned short>> Damage;
+            /// @brief Statistics about the last frame rendered by rinst()
+            FrameStats Stats;
+            /// @brief Reusable buffer for the characters of a run of cells that is being written
+            std::wstring RunBuffer;
+
+            /// @brief A run of neighbouring cells in a row that a matrix string wrote
+            struct TextSpan {
+                /// @brief y-position (row) of the run
+                unsigned short Y;
+                /// @brief x-position (col) of the first cell of the run
+                unsigned short X;
+                /// @brief Amount of cells in the run
+                unsigned short Length;
+                /// @brief Index of the run's first cell in TextBlock::Cells
+                unsigned int Offset;
+            };
+            /// @brief The cells that a matrix string writes, laid out and ready to be copied into Grid
+            struct TextBlock {
+                /// @brief Cells of every run, one run after the other
+                std::vector<Cell> Cells;
+                /// @brief Where each run goes (in the order they were written, since the dot of a j overlaps its glyph)
+                std::vector<TextSpan> Spans;
+                /// @brief Bottom-right corner of the last character (before the offset is applied)
+                std::pair<unsigned short, unsigned short> End;
+                /// @brief When the block was last drawn (compared against TextTick to find the least recently used block)
+                unsigned long Used = 0;
+            };
+            /// @brief Laid out matrix strings, keyed by everything that affects their layout (string, style, dangling letters, kerning, leading, wrap and position)
+            std::unordered_map<std::string, TextBlock> TextCache;
+            /// @brief A number registered with addField() that is kept on the window and rewritten in place
+            struct NumField {
+                /// @brief y-position (row) of the start of the field
+                unsigned short Y;
+                /// @brief x-position (col) of the start of the field
+                unsigned short X;
+                /// @brief How the field's values get formatted
+                NumFormat Format;
+                /// @brief Style ID from mpalette to write the field's cells with
+                unsigned int Style;
+                /// @brief Characters of the value that is on the window right now
+                wchar_t Text[NUM_BUFFER];
+                /// @brief Amount of characters in Text
+                unsigned short Length = 0;
+                /// @brief Whether the field is registered (removed fields are kept around to be reused)
+                bool Active = false;
+            };
+            /// @brief Every numeric field of the window, indexed by ID
+            std::vector<NumField> Fields;
+
+            /// @brief Sizes of the rows of the box or evenly sized grid being drawn (kept around so that drawing one doesn't allocate)
+            std::vector<unsigned short> GridRows;
+            /// @brief Sizes of the columns of the box or evenly sized grid being drawn (kept around so that drawing one doesn't allocate)
+            std::vector<unsigned short> GridCols;
+            /// @brief Which rows of the grid being composed have a horizontal line (kept around so that drawing a grid doesn't allocate)
+            std::vector<bool> GridLinesY;
+            /// @brief Which columns of the grid being composed have a vertical line (kept around so that drawing a grid doesn't allocate)
+            std::vector<bool> GridLinesX;
+            /// @brief Buffer that the key of TextCache is built in (reused so that looking a string up doesn't allocate)
+            std::string TextKey;
+            /// @brief Most amount of blocks that TextCache holds before the least recently used one is thrown out (0 turns the cache off)
+            unsigned short TextCacheSize = 32;
+            /// @brief Counts up every time a block is drawn
+            unsigned long TextTick = 0;
+            /// @brief Hits and misses of TextCache
+            TextCacheStats TextStats;
+
+            /// @brief A cell of the window and how far into a transition it gets revealed
+            struct OrderCell {
+                /// @brief How far into the transition (0 to 1, not including 1) the cell gets revealed
+                float Key;
+                /// @brief Index of the cell in Grid
+                unsigned int Index;
+            };
+            /// @brief Every cell sorted by when it gets revealed, for each transition (and its param) that the window has used (the window's size never changes, so each only has to be worked out once)
+            std::unordered_map<unsigned short, std::shared_ptr<const std::vector<OrderCell>>> Orders;
 
             //
             // INTERFACING WITH NCURSES
             //
 
-            /// @brief Write - Write a cell to the ncurses window
-            /// @param y Y-position (row) of the cell to write
-            /// @param x X-position (col) of the cell to write
-            void write(unsigned short y, unsigned short x);
+            /// @brief Write - Write a span of cells to the ncurses window or native terminal (and the front buffer), batching neighbouring cells with the same color and attributes into runs
+            /// @param y Y-position (row) of the cells to write
+            /// @param x X-position (col) of the first cell to write
+            /// @param length Amount of cells to write
+            void write(unsigned short y, unsigned short x, unsigned short length = 1);
+            /// @brief Present - Push everything that has been written so far to the terminal (wrefresh() or a flush of the native backend)
+            void present();
+            /// @brief Diff - Write the cells of a span that differ between the back buffer (Grid) and the front buffer (Front)
+            /// @param y Y-position (row) of the span
+            /// @param x X-position (col) of the first cell of the span
+            /// @param length Amount of cells in the span
+            void diff(unsigned short y, unsigned short x, unsigned short length);
+            /// @brief Flush Damage - Write every damaged span that differs from the front buffer (without presenting it)
+            void flushDamage();
+            /// @brief Get Windows - Get every window that exists right now
+            /// @returns The windows (kept in a function so that it's ready for windows made before main())
+            static std::vector<Window*> &gwindows();
+            /// @brief Collect Styles - Mark every style ID that is still in a window (cells, front buffer, cached text and fields) so that mpalette can collect the rest
+            static void collectStyles();
+            /// @brief Same Style - Check whether two cells use the same colors and attributes (the merge flag doesn't count)
+            /// @param a First cell
+            /// @param b Second cell
+            /// @returns True if the cells have the same color pair, 24-bit colors, and attributes
+            bool sameStyle(const Cell &a, const Cell &b);
+            /// @brief Same Look - Check whether two cells would look identical on the screen
+            /// @param a First cell
+            /// @param b Second cell
+            /// @returns True if the cells have the same character, color, and attributes
+            bool sameLook(const Cell &a, const Cell &b);
+            /// @brief Cell Attributes - Get the ncurses attribute bits of a cell (cached in the palette)
+            /// @param cell Cell to get the attributes of
+            /// @returns The ncurses attributes (without the color pair) that the cell uses
+            attr_t cellAttributes(const Cell &cell);
+            /// @brief Cell Pair - Get the ncurses color pair to write a cell with (cached in the palette; cells with 24-bit colors get a pair of the closest 256 colors from alloc_pair())
+            /// @param cell Cell to get the color pair of
+            /// @returns An ncurses color pair number
+            int cellPair(const Cell &cell);
 
-            /// @brief Extract Attributes - Extract a string input into a set of booleans
-            /// @param input Set of attributes to unapply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
-            /// @returns A vector (size of 10) of booleans representing attributes
-            std::vector<bool> extractAttributes(std::string input);
             /// @brief Toggle Cell Attributes - Toggle the attributes being used when writing to a cell - boolean based (acts as wattron() or wattroff())
             /// @param bold Bold
             /// @param italic Italic
@@ -90,9 +200,9 @@ namespace npp {
             /// @param prot Protected
             /// @param alt Alt Char Set
             void toggleAttributes(bool bold, bool italic, bool under, bool rev, bool blink, bool dim, bool invis, bool stand, bool prot, bool alt);
-            /// @brief Toggle Cell Attributes - Toggle the attributes being used when writing to a cell - string based (acts as wattron() or wattroff())
-            /// @param input A string that should consist of two-letter keys for which attributes to toggle
-            void toggleAttributes(std::string input);
+            /// @brief Toggle Cell Attributes - Toggle the attributes being used when writing to a cell - style based (acts as wattron() or wattroff())
+            /// @param input Text style (or a string of two-letter keys) with the attributes to toggle
+            void toggleAttributes(TextStyle input);
 
             //
             // TIMING
@@ -103,6 +213,95 @@ namespace npp {
             /// @param skippable Whether the wait can be skipped (with a keyboard input) or not
             /// @returns True if the wait was skipped, false if the wait wasn't
             bool wait(unsigned long millis);
+            /// @brief Wait for Input - Block until there is an input or a deadline passes, without waking up in between (poll() on stdin, or on minput's queue while its thread is running)
+            /// @param deadline Point in time to give up at
+            /// @returns The input (same as gchar()) or ERR if the deadline passed first
+            int waitInput(std::chrono::steady_clock::time_point deadline);
+
+            //
+            // GRID ACCESS
+            //
+
+            /// @brief Cell At - Get a cell from the grid (no bounds checking)
+            /// @param y y-position (row) of the cell
+            /// @param x x-position (col) of the cell
+            /// @returns A reference to the cell
+            Cell &cellAt(unsigned short y, unsigned short x);
+            /// @brief Row - Get the span of cells making up a row of the grid (no bounds checking)
+            /// @param y y-position (row) of the row
+            /// @returns A pointer to the first cell of the row, which is followed by the rest of the row's DimX cells
+            Cell *row(unsigned short y);
+
+            //
+            // DAMAGE TRACKING
+            //
+
+            /// @brief Put Cell - Set the contents of a cell and mark it as needing to be rendered
+            /// @param y y-position (row) of the cell
+            /// @param x x-position (col) of the cell
+            /// @param input Character for the cell
+            /// @param style Style ID from mpalette
+            void putCell(unsigned short y, unsigned short x, wchar_t input, unsigned int style);
+            /// @brief Write String (Core) - Write a string to the window with attributes that have already been extracted
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (unicode friendly)
+            /// @param style Style ID from mpalette to use when writing each cell
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrcore(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int style, std::pair<unsigned short, unsigned short> offset, bool wrap);
+            /// @brief Write UTF-8 String (Core) - Decode a UTF-8 string straight into the window with attributes that have already been extracted (runs of ASCII are copied 16 bytes at a time where SSE2 is available)
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input UTF-8 string input to be written (malformed bytes are written as U+FFFD)
+            /// @param style Style ID from mpalette to use when writing each cell
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset (the same as wstrcore() with the decoded string)
+            std::pair<unsigned short, unsigned short> wstrcore(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int style, std::pair<unsigned short, unsigned short> offset, bool wrap);
+            /// @brief Write Field - Write the new characters of a numeric field, skipping the ones that haven't changed since its last value
+            /// @param field Field to write to
+            /// @param text Characters of the new value
+            /// @param length Amount of characters in text
+            void writeField(NumField &field, const wchar_t *text, unsigned short length);
+
+            /// @brief Layout Text - Work out the cells that a matrix string writes without writing them
+            /// @param block Block to lay the string out into
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the top-left corner of the first character of the string
+            /// @param input String input to be laid out
+            /// @param style Style ID from mpalette to use for each cell
+            /// @param danglingLetters Whether to allow certain letters to hang beneath the usual line (increases leading by 1)
+            /// @param kerning The amount of spaces between each letter
+            /// @param leading The amount of spaces between each line
+            /// @param wrap Whether to wrap to starting x or not
+            void layoutText(TextBlock &block, std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int style, bool danglingLetters, unsigned char kerning, unsigned char leading, bool wrap);
+            /// @brief Trim Text - Throw out the least recently used laid out matrix strings until the cache is small enough
+            /// @param size Most amount of strings to keep
+            void trimText(unsigned short size);
+            /// @brief Blit Text - Copy the cells of a laid out matrix string into the window
+            /// @param block Block to copy
+            void blitText(const TextBlock &block);
+
+            /// @brief Get Order - Get every cell of the window sorted by when a transition reveals it (cached)
+            /// @param effect Which transition (TRANSITION_ROWS, TRANSITION_RADIAL, etc.)
+            /// @param param Extra number that changes the ordering of some transitions (see each TRANSITION_*)
+            /// @returns The sorted cells
+            std::shared_ptr<const std::vector<OrderCell>> getOrder(unsigned char effect, unsigned char param);
+            /// @brief Animate Order - Make an animation that reveals cells in the order given, a frame's worth at a time
+            /// @param order Cells sorted by when they get revealed
+            /// @param millis Milliseconds the whole animation should take
+            /// @param curve How the reveal progresses over time (CURVE_LINEAR, CURVE_EASE_IN, etc.)
+            /// @param rev Whether to go through the order backwards
+            /// @param offset Key (0 to 1) to start from, wrapping around the order (for transitions like TRANSITION_RADIAL that go in a circle)
+            /// @returns An animation to pass to manim.add()
+            Animation aorder(std::shared_ptr<const std::vector<OrderCell>> order, unsigned long millis, unsigned char curve, bool rev, double offset);
+
+            /// @brief Damage - Mark a span of cells in a row as needing to be rendered
+            /// @param y y-position (row) of the span
+            /// @param x x-position (col) of the start of the span
+            /// @param length Amount of cells in the span
+            void damage(unsigned short y, unsigned short x, unsigned short length = 1);
+            /// @brief Damage All - Mark every cell in the window as needing to be rendered
+            void damageAll();
 
             //
             // COMMON CHECKS & CODE SHORTCUTS
@@ -132,8 +331,24 @@ namespace npp {
             /// @brief Get Piece - Convert a set of directions (connection styles) and a line style into the corresponding unicode character
             /// @param dir A set of four directions (up, down, left, right)
             /// @param style A pair consisting of a number corresponding to the main style (0 = Light Hard, 1 = Light Soft, 2 = Heavy Both, 3 = Heavy Horizontal, 4 = Heavy Vertical, 5 = Doubled Both, 6 = Doubled Horizontal, 7 = Doubled Vertical) and a number corresponding to the dash style (0 = None, 1 = Double, 2 = Triple, 3 = Quardruple, 4 = Single 1, 5 = Single 2)
-            /// @returns A unicode character (box drawing) if a match to the directions is found, a space if a match isn't found
-            const wchar_t getPiece(std::vector<unsigned char> dir, std::pair<unsigned char, unsigned char> style);
+            /// @returns A unicode character (box drawing) if a match to the directions is found (heavy/doubled directions that can't be meshed are swapped to the style's), a space if a match isn't found
+            const wchar_t getPiece(const unsigned char (&dir)[4], std::pair<unsigned char, unsigned char> style);
+            /// @brief Get Line Style - Get the connection style that a line of a box style is drawn with
+            /// @param style Box style (LIGHT_HARD, HEAVY_BOTH, etc.)
+            /// @param vertical Whether the line is vertical or horizontal
+            /// @returns A number 1-3: 1 = Light, 2 = Heavy, 3 = Double
+            const unsigned char getLineStyle(unsigned char style, bool vertical);
+
+            /// @brief Compose Grid - Draw every line of a grid in a single pass, working out each cell's connections before its piece is written (so crossings are only written once and don't depend on draw order)
+            /// @param y y-position (row) of the top-left corner of the grid
+            /// @param x x-position (col) of the top-left corner of the grid
+            /// @param rowDims Height (rows) between the horizontal lines of each row of cells
+            /// @param colDims Length (cols) between the vertical lines of each column of cells
+            /// @param style A pair consisting of a number corresponding to the main style and a number corresponding to the dash style
+            /// @param color Color pair to use when drawing the lines
+            /// @param mergeable Whether the lines will be able to be merged with future lines
+            /// @param canMerge Whether the lines will be able to merge with pre-existing box-drawing characters around them
+            void composeGrid(unsigned short y, unsigned short x, const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge);
 
         public:
             /// @brief Create an ncursespp Window
@@ -151,6 +366,11 @@ namespace npp {
             /// @param dimy Height (rows) of the Window
             /// @param dimx Length (cols) of the Window
             Window(Window &win, unsigned short dimy, unsigned short dimx);
+            /// @brief Create a copy of a Window (it's tracked on its own, so its cells keep their styles alive too)
+            /// @param win Window to copy
+            Window(const Window &win);
+            /// @brief Stop tracking the Window's styles
+            ~Window();
 
             //
             // MISC
@@ -169,6 +389,12 @@ namespace npp {
             /// @brief Update Skippability - Change whether the window will allow the user to skip wait() functions
             /// @param skippable Whether the window will allow the user to skip or not
             void uskip(bool skippable);
+            /// @brief Get Skippability - Get whether the window allows the user to skip wait() functions
+            /// @returns True if the window can be skipped, false if not
+            const bool gskip();
+            /// @brief Update Text Cache - Change how many laid out matrix strings the window keeps around to redraw without laying them out again
+            /// @param size Most amount of strings to keep (0 turns the cache off and empties it)
+            void utextcache(unsigned short size = 32);
 
             /// @brief Update Padding (Reset) - Reset the window's padding (sets all padding to zero)
             void upreset();
@@ -216,6 +442,12 @@ namespace npp {
             /// @brief Get Padding (Right) - Get the amount of characters padding the right of the screen
             /// @returns The amount of characters padding the right of the screen
             const unsigned short gpadr();
+            /// @brief Get Stats - Get the statistics of the last frame rendered by rinst()
+            /// @returns A FrameStats containing the amount of cells that were written during the last frame
+            const FrameStats gstats();
+            /// @brief Get Text Cache - Get the statistics of the window's cache of laid out matrix text
+            /// @returns A TextCacheStats containing the hits, misses and amount of cached strings
+            const TextCacheStats gtextcache();
 
             /// @brief Scan Character - Get the character of a cell from a window
             /// @param y y-position (row) of the cell to scan
@@ -227,6 +459,16 @@ namespace npp {
             /// @param x x-position (col) of the cell to scan
             /// @returns The number of the color pair a cell uses or the default pair for the window if the requested cell doesn't exist
             const unsigned char scolor(unsigned short y, unsigned short x);
+            /// @brief Scan Foreground - Get the 24-bit foreground color of a cell from a window
+            /// @param y y-position (row) of the cell to scan
+            /// @param x x-position (col) of the cell to scan
+            /// @returns The packed color (RGB_SET | 0xRRGGBB) or 0 if the cell uses its color pair's foreground (or doesn't exist)
+            const unsigned int sfg(unsigned short y, unsigned short x);
+            /// @brief Scan Background - Get the 24-bit background color of a cell from a window
+            /// @param y y-position (row) of the cell to scan
+            /// @param x x-position (col) of the cell to scan
+            /// @returns The packed color (RGB_SET | 0xRRGGBB) or 0 if the cell uses its color pair's background (or doesn't exist)
+            const unsigned int sbg(unsigned short y, unsigned short x);
             /// @brief Scan Bold - Get whether a cell from a window is bolded or not
             /// @param y y-position (row) of the cell to scan
             /// @param x x-position (col) of the cell to scan
@@ -289,83 +531,117 @@ namespace npp {
 
             /// @brief Clear the window without removing cell data
             void clear();
-            /// @brief Clear the window and remove cell data
+            /// @brief Remove all cell data (the screen is updated by the next render, which only writes the cells that actually change)
             void reset();
 
             /// @brief Write Character, Return Position - Write a single character to the window - pair pos, pair return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the character's position and the inputted offset
-            std::pair<unsigned short, unsigned short> wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            std::pair<unsigned short, unsigned short> wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return Position - Write a single character (wchar_t) to the window - short short pos, pair return
             /// @param y y-position (row) of the character
             /// @param x x-position (col) of the character
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the character's position and the inputted offset
-            std::pair<unsigned short, unsigned short> wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            std::pair<unsigned short, unsigned short> wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return Y-Position - Write a single character to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A y-position (row) based off of the character's position and the inputted offset
-            unsigned short wchary(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            unsigned short wchary(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return Y-Position - Write a single character to the window - short short pos, short return
             /// @param y y-position (row) of the character
             /// @param x x-position (col) of the character
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A y-position (row) based off of the character's position and the inputted offset
-            unsigned short wchary(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            unsigned short wchary(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return X-Position - Write a single character to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A x-position (col) based off of the character's position and the inputted offset
-            unsigned short wcharx(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            unsigned short wcharx(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return X-Position - Write a single character to the window - short short pos, short return
             /// @param y y-position (row) of the character
             /// @param x x-position (col) of the character
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @returns A x-position (col) based off of the character's position and the inputted offset
-            unsigned short wcharx(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            unsigned short wcharx(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
             /// @brief Write Character, Return Nothing - Write a single character to the window - pair pos, no return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
-            void wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes);
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            void wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes);
             /// @brief Write Character, Return Nothing - Write a single character to the window - short short pos, no return
             /// @param y y-position (row) of the character
             /// @param x x-position (col) of the character
             /// @param input Wide character input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
-            void wchar(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes);
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            void wchar(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes);
+            /// @brief Write Character, Return Position - Write a single character to the window with 24-bit colors - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
+            /// @param input Wide character input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the character's position and the inputted offset
+            std::pair<unsigned short, unsigned short> wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            /// @brief Write Character, Return Position - Write a single character to the window with 24-bit colors - short short pos, pair return
+            /// @param y y-position (row) of the character
+            /// @param x x-position (col) of the character
+            /// @param input Wide character input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the character's position and the inputted offset
+            std::pair<unsigned short, unsigned short> wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset);
+            /// @brief Write Character, Return Nothing - Write a single character to the window with 24-bit colors - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) for the character to be written at
+            /// @param input Wide character input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            void wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes);
+            /// @brief Write Character, Return Nothing - Write a single character to the window with 24-bit colors - short short pos, no return
+            /// @param y y-position (row) of the character
+            /// @param x x-position (col) of the character
+            /// @param input Wide character input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            void wchar(unsigned short y, unsigned short x, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes);
 
             /// @brief Write String, Return Position - Write a string to the window - pair pos, pair return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
-            std::pair<unsigned short, unsigned short> wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return Position - Write a string to the window - short short pos, pair return
             /// @param y y-position (row) of the start of the string
             /// @param x x-position (col) of the start of the string
@@ -375,141 +651,388 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
-            std::pair<unsigned short, unsigned short> wstrp(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wstrp(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return Y-Position - Write a string to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A y-position (row) based off of the last character of the string that was written and the inputted offset
-            unsigned short wstry(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wstry(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return Y-Position - Write a string to the window - short short pos, short return
             /// @param y y-position (row) of the start of the string
             /// @param x x-position (col) of the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A y-position (row) based off of the last character of the string that was written and the inputted offset
-            unsigned short wstry(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wstry(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return X-Position - Write a string to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A x-position (col) based off of the last character of the string that was written and the inputted offset
-            unsigned short wstrx(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wstrx(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return X-Position - Write a string to the window - short short pos, short return
             /// @param y y-position (row) of the start of the string
             /// @param x x-position (col) of the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A x-position (col) based off of the last character of the string that was written and the inputted offset
-            unsigned short wstrx(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wstrx(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return Nothing - Write a string to the window - pair pos, no return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param wrap Whether to wrap to starting x or not
-            void wstr(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            void wstr(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
             /// @brief Write String, Return Nothing - Write a string to the window - short short pos, no return
             /// @param y y-position (row) of the start of the string
             /// @param x x-position (col) of the start of the string
             /// @param input String input to be written (unicode friendly)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write String, Return Position - Write a string to the window with 24-bit colors - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write String, Return Position - Write a string to the window with 24-bit colors - short short pos, pair return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(unsigned short y, unsigned short x, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write String, Return Nothing - Write a string to the window with 24-bit colors - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write String, Return Nothing - Write a string to the window with 24-bit colors - short short pos, no return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (unicode friendly)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(unsigned short y, unsigned short x, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Position - Write a UTF-8 string to the window - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Position - Write a UTF-8 string to the window - short short pos, pair return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Set of attributes to unapply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Y-Position - Write a UTF-8 string to the window - pair pos, short return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A y-position (row) based off of the last character of the string that was written and the inputted offset
+            unsigned short wstry(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Y-Position - Write a UTF-8 string to the window - short short pos, short return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A y-position (row) based off of the last character of the string that was written and the inputted offset
+            unsigned short wstry(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return X-Position - Write a UTF-8 string to the window - pair pos, short return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A x-position (col) based off of the last character of the string that was written and the inputted offset
+            unsigned short wstrx(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return X-Position - Write a UTF-8 string to the window - short short pos, short return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A x-position (col) based off of the last character of the string that was written and the inputted offset
+            unsigned short wstrx(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Nothing - Write a UTF-8 string to the window - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Nothing - Write a UTF-8 string to the window - short short pos, no return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Position - Write a UTF-8 string to the window with 24-bit colors - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
-            void wstr(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Position - Write a UTF-8 string to the window with 24-bit colors - short short pos, pair return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the string that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wstrp(unsigned short y, unsigned short x, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Nothing - Write a UTF-8 string to the window with 24-bit colors - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write UTF-8 String, Return Nothing - Write a UTF-8 string to the window with 24-bit colors - short short pos, no return
+            /// @param y y-position (row) of the start of the string
+            /// @param x x-position (col) of the start of the string
+            /// @param input String input to be written (UTF-8, decoded straight into the window)
+            /// @param fg Foreground color made with rgb() (0 to use the foreground of Defaults.Color)
+            /// @param bg Background color made with rgb() (0 to use the background of Defaults.Color)
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wstr(unsigned short y, unsigned short x, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
 
             /// @brief Write Integer, Return Position - Write an integer to the window - pair pos, pair return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of a y-position (row) and x-position (col) of the last character of the integer that was written
-            std::pair<unsigned short, unsigned short> wintp(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wintp(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return Position - Write an integer to the window - short short pos, pair return
             /// @param y y-position (row) of the start of the integer
             /// @param x x-position (col) of the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of the y-position (row) and x-position (col) of the last character of the integer that was written
-            std::pair<unsigned short, unsigned short> wintp(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wintp(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return Y-Position - Write an integer to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A y-position (row) based off of the last character of the integer that was written and the inputted offset
-            unsigned short winty(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short winty(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return Y-Position - Write an integer to the window - short short pos, short return
             /// @param y y-position (row) of the start of the integer
             /// @param x x-position (col) of the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A y-position (row) based off of the last character of the integer that was written and the inputted offset
-            unsigned short winty(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short winty(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return X-Position - Write an integer to the window - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A x-position (col) based off of the last character of the integer that was written and the inputted offset
-            unsigned short wintx(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wintx(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return X-Position - Write an integer to the window - short short pos, short return
             /// @param y y-position (row) of the start of the integer
             /// @param x x-position (col) of the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A x-position (col) based off of the last character of the integer that was written and the inputted offset
-            unsigned short wintx(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wintx(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return Nothing - Write an integer to the window - pair pos, no return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param wrap Whether to wrap to starting x or not
-            void wint(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            void wint(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
             /// @brief Write Integer, Return Nothing - Write an integer to the window - short short pos, no return
             /// @param y y-position (row) of the start of the integer
             /// @param x x-position (col) of the start of the integer
             /// @param input Integer input to be written
             /// @param minWidth Minimum width for the integer to be (leading zeros will be added to meet the width)
             /// @param color Color pair to use when writing each cell
-            /// @param att Set of attributes to apply (in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
             /// @param wrap Whether to wrap to starting x or not
-            void wint(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            void wint(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+
+            /// @brief Write Long, Return Position - Write a 64-bit (or fixed-point) whole number to the window without allocating - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the number that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wlongp(std::pair<unsigned short, unsigned short> pos, long long input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write Long, Return Position - Write a 64-bit (or fixed-point) whole number to the window without allocating - short short pos, pair return
+            /// @param y y-position (row) of the start of the number
+            /// @param x x-position (col) of the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the number that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wlongp(unsigned short y, unsigned short x, long long input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write Long, Return Nothing - Write a 64-bit (or fixed-point) whole number to the window without allocating - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wlong(std::pair<unsigned short, unsigned short> pos, long long input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write Long, Return Nothing - Write a 64-bit (or fixed-point) whole number to the window without allocating - short short pos, no return
+            /// @param y y-position (row) of the start of the number
+            /// @param x x-position (col) of the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wlong(unsigned short y, unsigned short x, long long input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+
+            /// @brief Write Float, Return Position - Write a decimal number to the window without allocating - pair pos, pair return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the number that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wfloatp(std::pair<unsigned short, unsigned short> pos, double input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write Float, Return Position - Write a decimal number to the window without allocating - short short pos, pair return
+            /// @param y y-position (row) of the start of the number
+            /// @param x x-position (col) of the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
+            /// @param wrap Whether to wrap to starting x or not
+            /// @returns A pair consisting of a y-position (row) and an x-position (col) based off of the last character of the number that was written and the inputted offset
+            std::pair<unsigned short, unsigned short> wfloatp(unsigned short y, unsigned short x, double input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            /// @brief Write Float, Return Nothing - Write a decimal number to the window without allocating - pair pos, no return
+            /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wfloat(std::pair<unsigned short, unsigned short> pos, double input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+            /// @brief Write Float, Return Nothing - Write a decimal number to the window without allocating - short short pos, no return
+            /// @param y y-position (row) of the start of the number
+            /// @param x x-position (col) of the start of the number
+            /// @param input Number to be written
+            /// @param format Minimum width, precision and thousands separator to format the number with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @param wrap Whether to wrap to starting x or not
+            void wfloat(unsigned short y, unsigned short x, double input, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes, bool wrap = Defaults.Wrap);
+
+            /// @brief Add Field - Register a numeric field that keeps what it last wrote, so that updating it only rewrites the characters that changed (anything else written over the field stays until those characters change)
+            /// @param y y-position (row) of the start of the field
+            /// @param x x-position (col) of the start of the field
+            /// @param format Minimum width, precision and thousands separator to format the field's values with
+            /// @param color Color pair to use when writing each cell
+            /// @param att Text style (or set of attributes to apply, in any order): bo = Bold, it = Italic, un = Underline, re = Reverse, bl = Blink, di = Dim, in = Invisible, st = Standout, pr = Protected, al = Altset
+            /// @returns ID of the field, for ufield() and removeField()
+            unsigned short addField(unsigned short y, unsigned short x, NumFormat format = Defaults.Format, unsigned char color = Defaults.Color, TextStyle att = Defaults.Attributes);
+            /// @brief Update Field - Write a new whole (or fixed-point) value to a numeric field
+            /// @param id ID of the field
+            /// @param input New value
+            void ufield(unsigned short id, long long input);
+            /// @brief Update Field (Float) - Write a new decimal value to a numeric field
+            /// @param id ID of the field
+            /// @param input New value
+            void ufieldf(unsigned short id, double input);
+            /// @brief Remove Field - Stop keeping track of a numeric field (what it last wrote is left on the window)
+            /// @param id ID of the field
+            /// @returns Whether the field existed
+            bool removeField(unsigned short id);
 
             /// @brief Write Matrix String, Return Position - Write a string to the window using the 6x6 matrix text - pair pos, pair return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the top-left corner of the first character of the string
@@ -521,7 +1044,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of a y-position (row) and x-position (col) of the bottom-right corner of the last character of the text that was written
-            std::pair<unsigned short, unsigned short> wmstrp(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wmstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return Position - Write a string to the window using the 6x6 matrix text - short short pos, pair return
             /// @param y y-position (row) indicating the top-left corner of the first character of the string
             /// @param x x-position (col) indicating the top-left corner of the first character of the string
@@ -533,7 +1056,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns A pair consisting of a y-position (row) and x-position (col) of the bottom-right corner of the last character of the text that was written
-            std::pair<unsigned short, unsigned short> wmstrp(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            std::pair<unsigned short, unsigned short> wmstrp(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return Y-Position - Write a string to the window using the 6x6 matrix text - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the top-left corner of the first character of the string
             /// @param input String input to be written (no unicode, somewhat limited character set)
@@ -544,7 +1067,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns The y-position (row) of the bottom-right corner of the last character of the text that was written
-            unsigned short wmstry(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wmstry(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return Y-Position - Write a string to the window using the 6x6 matrix text - short short pos, short return
             /// @param y y-position (row) indicating the top-left corner of the first character of the string
             /// @param x x-position (col) indicating the top-left corner of the first character of the string
@@ -556,7 +1079,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns The y-position (row) of the bottom-right corner of the last character of the text that was written
-            unsigned short wmstry(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wmstry(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return X-Position - Write a string to the window using the 6x6 matrix text - pair pos, short return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the top-left corner of the first character of the string
             /// @param input String input to be written (no unicode, somewhat limited character set)
@@ -567,7 +1090,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns The x-position (col) of the bottom-right corner of the last character of the text that was written
-            unsigned short wmstrx(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wmstrx(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return X-Position - Write a string to the window using the 6x6 matrix text - short short pos, short return
             /// @param y y-position (row) indicating the top-left corner of the first character of the string
             /// @param x x-position (col) indicating the top-left corner of the first character of the string
@@ -579,7 +1102,7 @@ namespace npp {
             /// @param offset Pair consisiting of a y-offset (rows) and an x-offset (cols) that changes the return value
             /// @param wrap Whether to wrap to starting x or not
             /// @returns The x-position (col) of the bottom-right corner of the last character of the text that was written
-            unsigned short wmstrx(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
+            unsigned short wmstrx(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return Nothing - Write a string to the window using the 6x6 matrix text - pair pos, no return
             /// @param pos Pair consisting of a y-position (row) and an x-position (col) indicating the top-left corner of the first character of the string
             /// @param input String input to be written (no unicode, somewhat limited character set)
@@ -588,7 +1111,7 @@ namespace npp {
             /// @param kerning The amount of spaces between each letter
             /// @param leading The amount of spaces between each line
             /// @param wrap Whether to wrap to starting x or not
-            void wmstr(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap);
+            void wmstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap);
             /// @brief Write Matrix String, Return Nothing - Write a string to the window using the 6x6 matrix text - short short pos, no return
             /// @param y y-position (row) indicating the top-left corner of the first character of the string
             /// @param x x-position (col) indicating the top-left corner of hte first character of the string
@@ -598,13 +1121,13 @@ namespace npp {
             /// @param kerning The amount of spaces between each letter
             /// @param leading The amount of spaces between each line
             /// @param wrap Whether to wrap to starting x or not
-            void wmstr(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap);
+            void wmstr(unsigned short y, unsigned short x, std::string_view input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap);
 
             //
             // GET USER INPUT
             //
 
-            /// @brief Get Character - Get a single character input from the user (acts as the ncursespp version of wgetch())
+            /// @brief Get Character - Get a single character input from the user (acts as the ncursespp version of wgetch(); takes the input from minput while its thread is running, which also updates mmouse)
             /// @param enableKeypad Allow the use of arrow keys and such
             /// @param pause Pause the program until an input is read
             /// @param autoRender Automatically render the window when the function is called
@@ -616,20 +1139,24 @@ namespace npp {
             /// @param x x-position (col) of the start of the input location
             /// @param maxChars Maximum amount of characters the string can contain
             /// @param echoColor Color pair to use when echoing the user's input
-            /// @param echoAtt Set of attributes to apply to the echoed string
+            /// @param echoAtt Text style (or set of attributes) to apply to the echoed string
             /// @param autoWrite Whether to automatically write the inputted string to the window
             /// @param showStr Whether to echo the user's input or not
             /// @param showCursor Whether to show the cursor when taking an input or not
             /// @param enableKeypad Whether to allow the use of the keypad when taking the input
-            /// @returns A wide string (not unicode friendly :/)
-            std::wstring gstr(unsigned short y, unsigned short x, int maxChars = 255, unsigned char echoColor = Defaults.Color, std::string echoAtt = Defaults.Attributes, bool autoWrite = true, bool showStr = true, bool showCursor = true, bool enableKeypad = true);
+            /// @returns A wide string (not unicode friendly :/), empty if minput's thread is running (ncurses can't read stdin alongside it)
+            std::wstring gstr(unsigned short y, unsigned short x, int maxChars = 255, unsigned char echoColor = Defaults.Color, TextStyle echoAtt = Defaults.Attributes, bool autoWrite = true, bool showStr = true, bool showCursor = true, bool enableKeypad = true);
 
             //
             // RENDERING THE WINDOW
             //
 
-            /// @brief Render Instantly - Render the window instantly
+            /// @brief Render Instantly - Render the window instantly (only cells that differ from what is already on the screen are written)
             void rinst();
+            /// @brief Stage - Queue up everything written to the window so far so that it gets shown by the next present of the whole screen (used by the animator to present many windows at once)
+            void stage();
+            /// @brief Update Stats - Add what the last flush of the terminal cost to the window's frame statistics (used by the animator, which flushes for many windows at once)
+            void ustats();
 
             /// @brief Render by Line - Render the window line-by-line (and char-by-char if indicated)
             /// @param dir Direction to start from: 0 = Top-Left, 1 = Bottom-Left, 2 = Left-Top, 3 = Right-Top
@@ -663,9 +1190,41 @@ namespace npp {
             /// @param angle The starting angle of the main "sweeper" (expressed in degrees, 0 = midpoint of the right edge of the window)
             /// @param ccw Whether to "sweep" in a counter-clockwise direction or not
             /// @param millis Milliseconds to wait in between each line/character rendering
-            /// @param resolution Number that basically dictates how many steps are required to render each division (smaller number = slower, more accurate "sweeps")
+            /// @param resolution Angle (radians) that the "sweeper" moves every millis (smaller number = slower "sweeps")
             void rrad(unsigned char divisions = 2, double angle = 90, bool ccw = true, unsigned long millis = 5, double resolution = 0.005);
 
+            /// @brief Render Transition - Render the window with one of the built-in transitions
+            /// @param effect Which transition: TRANSITION_ROWS, TRANSITION_COLS, TRANSITION_CELLS_BY_ROW, TRANSITION_CELLS_BY_COL, TRANSITION_RADIAL, TRANSITION_SPIRAL, TRANSITION_DISSOLVE or TRANSITION_DIAGONAL
+            /// @param millis Milliseconds the whole transition should take
+            /// @param curve How the transition progresses over time: CURVE_LINEAR, CURVE_EASE_IN, CURVE_EASE_OUT or CURVE_EASE_IN_OUT
+            /// @param rev Whether to run the transition backwards (bottom to top for TRANSITION_ROWS, clockwise for TRANSITION_RADIAL, etc.)
+            /// @param param Extra number that changes some transitions (see each TRANSITION_*)
+            void rtrans(unsigned char effect, unsigned long millis = 500, unsigned char curve = CURVE_LINEAR, bool rev = false, unsigned char param = 0);
+
+            /// @brief Animate by Line - Make an animation that renders the window line-by-line (and char-by-char if indicated) for the animator to run alongside others
+            /// @param dir Direction to start from: 0 = Top-Left, 1 = Bottom-Left, 2 = Left-Top, 3 = Right-Top
+            /// @param full Whether to render the full line at once or not
+            /// @param rev Whether to reverse the char-by-char direction of rendering (has no effect if full is true)
+            /// @param millis Milliseconds each line/character rendering should take
+            /// @returns An animation to pass to manim.add()
+            Animation aline(unsigned char dir = 0, bool full = true, bool rev = false, unsigned long millis = 20);
+            /// @brief Animate in a Radial Motion - Make an animation that renders the window by "sweeping" a line in a radial motion for the animator to run alongside others
+            /// @param divisions Amount of divisions to split the window into and render individually
+            /// @param angle The starting angle of the main "sweeper" (expressed in degrees, 0 = midpoint of the right edge of the window)
+            /// @param ccw Whether to "sweep" in a counter-clockwise direction or not
+            /// @param millis Milliseconds the "sweeper" takes to move by resolution
+            /// @param resolution Angle (radians) that the "sweeper" moves every millis (smaller number = slower "sweeps")
+            /// @returns An animation to pass to manim.add()
+            Animation arad(unsigned char divisions = 2, double angle = 90, bool ccw = true, unsigned long millis = 5, double resolution = 0.005);
+            /// @brief Animate Transition - Make an animation that renders the window with one of the built-in transitions for the animator to run alongside others
+            /// @param effect Which transition: TRANSITION_ROWS, TRANSITION_COLS, TRANSITION_CELLS_BY_ROW, TRANSITION_CELLS_BY_COL, TRANSITION_RADIAL, TRANSITION_SPIRAL, TRANSITION_DISSOLVE or TRANSITION_DIAGONAL
+            /// @param millis Milliseconds the whole transition should take
+            /// @param curve How the transition progresses over time: CURVE_LINEAR, CURVE_EASE_IN, CURVE_EASE_OUT or CURVE_EASE_IN_OUT
+            /// @param rev Whether to run the transition backwards (bottom to top for TRANSITION_ROWS, clockwise for TRANSITION_RADIAL, etc.)
+            /// @param param Extra number that changes some transitions (see each TRANSITION_*)
+            /// @returns An animation to pass to manim.add()
+            Animation atrans(unsigned char effect, unsigned long millis = 500, unsigned char curve = CURVE_LINEAR, bool rev = false, unsigned char param = 0);
+
             //
             // LINE DRAWING
             //
@@ -751,6 +1310,16 @@ namespace npp {
             /// @param mergeable Whether the line will be able to be merged with future lines
             /// @param canMerge Whether the line will be able to merge with pre-existing box-drawing characters
             void dgrid(unsigned short y, unsigned short x, unsigned short cells, unsigned short cellDim, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge);
+            /// @brief Draw Grid - Draw a grid with rows and columns of different sizes - top left
+            /// @param y y-position of the top-left corner of the grid
+            /// @param x x-position of the top-left corner of the grid
+            /// @param rowDims Amount of characters between the horizontal lines of each row (one per row)
+            /// @param colDims Amount of characters between the vertical lines of each column (one per column)
+            /// @param style A pair consisting of a number corresponding to the main style (0 = Light Hard, 1 = Light Soft, 2 = Heavy Both, 3 = Heavy Horizontal, 4 = Heavy Vertical, 5 = Doubled Both, 6 = Doubled Horizontal, 7 = Doubled Vertical) and a number corresponding to the dash style (0 = None, 1 = Double, 2 = Triple, 3 = Quardruple, 4 = Single 1, 5 = Single 2)
+            /// @param color Color pair to use when drawing the line
+            /// @param mergeable Whether the line will be able to be merged with future lines
+            /// @param canMerge Whether the line will be able to merge with pre-existing box-drawing characters
+            void dgrid(unsigned short y, unsigned short x, const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge);
             /// @brief Draw Centered Grid - Draw a grid - center
             /// @param y y-position of the center corner of the grid
             /// @param x x-position of the center corner of the grid
@@ -781,5 +1350,13 @@ namespace npp {
             /// @param cellx Amount of characters between the vertical lines that make the cell borders
             /// @returns A pair consisting of a y-dimension (rows) and x-dimension (cols)
             std::pair<unsigned short, unsigned short> gGridDims(unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx);
-    } mwin;
+            /// @brief Get Grid Dimensions - Figure out the x and y dimensions of a grid with rows and columns of different sizes
+            /// @param rowDims Amount of characters between the horizontal lines of each row (one per row)
+            /// @param colDims Amount of characters between the vertical lines of each column (one per column)
+            /// @returns A pair consisting of a y-dimension (rows) and x-dimension (cols)
+            std::pair<unsigned short, unsigned short> gGridDims(const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims);
+    };
+
+    /// @brief The window covering the whole screen (set up by init())
+    extern Window mwin;
 }
@@ -0,0 +1,94 @@
+#include "Animator.hpp"
+
+npp::Animator npp::manim;
+
+void npp::Animator::present(const std::vector<Window*> &touched) {
+    if (touched.empty()) {return;}
+
+    // Every window gets queued up first so the whole tick reaches the terminal as a single frame
+    for (unsigned short i = 0; i < touched.size(); i++) {
+        touched[i]->stage();
+    }
+
+    if (mterm.gbackend() == BACKEND_NCURSES) {doupdate();}
+    else {mterm.flush();}
+
+    // The flush is shared, so each window it was made for is charged with all of it
+    for (unsigned short i = 0; i < touched.size(); i++) {
+        touched[i]->ustats();
+    }
+}
+
+void npp::Animator::add(Animation anim) {
+    anim.Done = 0;
+    anim.Start = std::chrono::steady_clock::now();
+    Active.push_back(anim);
+}
+
+bool npp::Animator::tick() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::vector<Window*> touched;
+
+    for (unsigned short i = 0; i < Active.size(); i++) {
+        Animation &anim = Active[i];
+        unsigned long target;
+
+        // Headless runs are meant to be deterministic, so they go exactly one step per tick
+        if (mterm.gbackend() == BACKEND_HEADLESS) {target = anim.Done + 1;}
+        else if (anim.Millis == 0) {target = anim.Steps;}
+        else {
+            unsigned long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - anim.Start).count();
+            // Falling behind just means writing several steps before the next present (rather than presenting each of them late)
+            target = elapsed >= anim.Millis ? anim.Steps : elapsed * anim.Steps / anim.Millis;
+        }
+        target = target > anim.Steps ? anim.Steps : target;
+
+        if (anim.Done >= target && anim.Done < anim.Steps) {continue;}
+
+        while (anim.Done < target) {anim.Step(anim.Done++);}
+        if (anim.Done >= anim.Steps && anim.Finish) {anim.Finish();}
+
+        if (std::find(touched.begin(), touched.end(), anim.Win) == touched.end()) {touched.push_back(anim.Win);}
+    }
+
+    Active.erase(std::remove_if(Active.begin(), Active.end(), [](const Animation &anim) {return anim.Done >= anim.Steps;}), Active.end());
+    present(touched);
+
+    return !Active.empty();
+}
+
+void npp::Animator::run() {
+    while (tick()) {
+        // Sleep until the soonest step is due
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        long millis = -1;
+        Window *waiter = Active[0].Win;
+
+        for (unsigned short i = 0; i < Active.size(); i++) {
+            const Animation &anim = Active[i];
+            std::chrono::steady_clock::time_point due = anim.Start + std::chrono::milliseconds((anim.Done + 1) * anim.Millis / anim.Steps);
+            long left = std::chrono::duration_cast<std::chrono::milliseconds>(due - now).count();
+
+            left = left < 0 ? 0 : left;
+            millis = (millis < 0 || left < millis) ? left : millis;
+            if (anim.Win->gskip()) {waiter = anim.Win;}
+        }
+
+        // rwait() only looks for input if the window allows skipping
+        if (millis > 0 && waiter->rwait(millis) != -1) {skip();}
+    }
+}
+
+void npp::Animator::skip() {
+    std::vector<Window*> touched;
+
+    for (unsigned short i = 0; i < Active.size(); i++) {
+        if (Active[i].Finish) {Active[i].Finish();}
+        if (std::find(touched.begin(), touched.end(), Active[i].Win) == touched.end()) {touched.push_back(Active[i].Win);}
+    }
+
+    Active.clear();
+    present(touched);
+}
+
+const unsigned long npp::Animator::gactive() {return Active.size();}
@@ -1,6 +1,6 @@
 #include "General.hpp"
 
-bool npp::init(bool useMouse = false) {
+bool npp::init(bool useMouse, unsigned char backend) {
     setlocale(LC_ALL, "");
     initscr();
     noecho();
@@ -8,6 +8,10 @@ bool npp::init(bool useMouse = false) {
     raw();
     srand(time(NULL));
 
+    // ncurses clears the screen on its first refresh, which has to happen before any native output or it would get wiped
+    if (backend == BACKEND_NATIVE) {refresh();}
+    mterm.ubackend(backend);
+
     if (!has_colors() || !can_change_color()) {
         mvwprintw(stdscr, LINES / 2 - 1, COLS / 2 - 50, "Warning: Your terminal doesn't support full color capabilites...");
         mvwprintw(stdscr, LINES / 2, COLS / 2 - 50, "ncursespp requires a terminal that allows for the changing of colors, so go find one that will work");
@@ -44,7 +48,117 @@ bool npp::init(bool useMouse = false) {
     return true;
 }
 
-int npp::end(bool useMouse = false, int funcReturn = 0) {
+void npp::initHeadless(unsigned short dimy, unsigned short dimx) {
+    setlocale(LC_ALL, "");
+    srand(time(NULL));
+
+    mterm.uheadless(dimy, dimx);
+    mwin = Window();
+}
+
+int npp::end(bool useMouse, int funcReturn) {
+    if (mterm.gbackend() == BACKEND_HEADLESS) {return funcReturn;}
+
     endwin();
     return funcReturn;
 }
+
+// Digits are written backwards from the end of the buffer and then moved to the front
+static unsigned short formatDigits(wchar_t (&buffer)[NUM_BUFFER], unsigned long long magnitude, bool negative, npp::NumFormat format) {
+    wchar_t *end = buffer + NUM_BUFFER, *out = end;
+    unsigned char precision = format.Precision > 19 ? 19 : format.Precision;
+    negative = negative && magnitude != 0;
+
+    if (precision > 0) {
+        for (unsigned char i = 0; i < precision; i++, magnitude /= 10) {*--out = L'0' + magnitude % 10;}
+        *--out = L'.';
+    }
+
+    // There's always at least one whole digit
+    unsigned char digits = 0;
+    do {
+        if (format.Separator != L'\0' && digits > 0 && digits % 3 == 0) {*--out = format.Separator;}
+        *--out = L'0' + magnitude % 10;
+        magnitude /= 10;
+        digits++;
+    } while (magnitude > 0);
+
+    // Leading zeros go after the sign, which counts towards the width
+    unsigned short width = format.MinWidth > NUM_BUFFER ? NUM_BUFFER : format.MinWidth;
+    while (end - out + (negative ? 1 : 0) < width) {*--out = L'0';}
+    if (negative) {*--out = L'-';}
+
+    std::copy(out, end, buffer);
+    return end - out;
+}
+
+unsigned short npp::formatInt(wchar_t (&buffer)[NUM_BUFFER], long long input, NumFormat format) {
+    // Negating as unsigned keeps the smallest long long from overflowing
+    return formatDigits(buffer, input < 0 ? 0ULL - (unsigned long long)input : input, input < 0, format);
+}
+
+unsigned short npp::formatFloat(wchar_t (&buffer)[NUM_BUFFER], double input, NumFormat format) {
+    unsigned char precision = format.Precision > 19 ? 19 : format.Precision;
+    double scaled = std::round(std::fabs(input) * std::pow(10.0, precision));
+
+    // Too large (or not a number at all) to go through the digits
+    if (!std::isfinite(scaled) || scaled >= 1.8e19) {
+        int length = swprintf(buffer, NUM_BUFFER, std::isfinite(input) ? L"%.*e" : L"%.*f", precision, input);
+        return length < 0 ? 0 : length;
+    }
+
+    return formatDigits(buffer, (unsigned long long)scaled, std::signbit(input), format);
+}
+
+wchar_t npp::decodeUtf8(const unsigned char *&input, const unsigned char *end) {
+    unsigned char lead = *input;
+    if (lead < 0x80) {
+        input++;
+        return lead;
+    }
+
+    // UTF-8 characters come in one to four bytes
+    unsigned char bytes = lead < 0xC2 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+    if (bytes == 0 || end - input < bytes) {
+        input++;
+        return L'�';
+    }
+
+    unsigned int code = bytes == 2 ? lead & 0x1F : bytes == 3 ? lead & 0x0F : lead & 0x07;
+    for (unsigned char i = 1; i < bytes; i++) {
+        if ((input[i] & 0xC0) != 0x80) {
+            input++;
+            return L'�';
+        }
+        code = (code << 6) | (input[i] & 0x3F);
+    }
+
+    // Overlong encodings, surrogates and anything past U+10FFFF aren't real characters
+    if ((bytes == 3 && code < 0x800) || (bytes == 4 && (code < 0x10000 || code > 0x10FFFF)) || (code >= 0xD800 && code <= 0xDFFF)) {
+        input++;
+        return L'�';
+    }
+
+    input += bytes;
+    return code;
+}
+
+#ifdef NPP_DEBUG
+// Every allocation the program makes goes through these, so they're counted right here
+static std::atomic<unsigned long> allocations(0);
+
+void *operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size ? size : 1);
+    if (ptr == nullptr) {throw std::bad_alloc();}
+
+    return ptr;
+}
+void *operator new[](std::size_t size) {return operator new(size);}
+void operator delete(void *ptr) noexcept {std::free(ptr);}
+void operator delete[](void *ptr) noexcept {std::free(ptr);}
+void operator delete(void *ptr, std::size_t) noexcept {std::free(ptr);}
+void operator delete[](void *ptr, std::size_t) noexcept {std::free(ptr);}
+
+unsigned long npp::gallocs() {return allocations.load(std::memory_order_relaxed);}
+#endif
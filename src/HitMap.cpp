@@ -0,0 +1,133 @@
+#include "HitMap.hpp"
+
+npp::HitMap::HitMap(unsigned short dimy, unsigned short dimx, unsigned char bucketDim) {
+    DimY = dimy;
+    DimX = dimx;
+    BucketDim = bucketDim < 1 ? 1 : bucketDim;
+    BucketsX = (DimX + BucketDim - 1) / BucketDim;
+    Buckets.resize(BucketsX * ((DimY + BucketDim - 1) / BucketDim));
+}
+
+npp::HitMap::Span npp::HitMap::gspan(const Region &region) {
+    Span span;
+    if (region.DimY < 1 || region.DimX < 1 || region.Y >= DimY || region.X >= DimX) {return span;}
+
+    // Only the part of the region that lies within the map has buckets
+    unsigned short lastY = (region.Y + region.DimY > DimY) ? DimY - 1 : region.Y + region.DimY - 1;
+    unsigned short lastX = (region.X + region.DimX > DimX) ? DimX - 1 : region.X + region.DimX - 1;
+
+    span.FirstY = region.Y / BucketDim;
+    span.LastY = lastY / BucketDim;
+    span.FirstX = region.X / BucketDim;
+    span.LastX = lastX / BucketDim;
+    return span;
+}
+
+void npp::HitMap::link(unsigned int id, bool insert, const Span &span, const Span &skip) {
+    for (unsigned short by = span.FirstY; by <= span.LastY; by++) {
+        for (unsigned short bx = span.FirstX; bx <= span.LastX; bx++) {
+            if (skip.contains(by, bx)) {continue;}
+            std::vector<unsigned int> &bucket = Buckets[by * BucketsX + bx];
+
+            if (insert) {bucket.push_back(id);}
+            else {
+                // Order within a bucket doesn't matter, so the last ID just takes the removed one's place
+                std::vector<unsigned int>::iterator found = std::find(bucket.begin(), bucket.end(), id);
+                if (found != bucket.end()) {
+                    *found = bucket.back();
+                    bucket.pop_back();
+                }
+            }
+        }
+    }
+}
+
+unsigned int npp::HitMap::add(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, int z) {
+    unsigned int id;
+    if (Free.empty()) {
+        id = Regions.size();
+        Regions.push_back(Region());
+    } else {
+        id = Free.back();
+        Free.pop_back();
+    }
+
+    Region &region = Regions[id];
+    region.Y = y;
+    region.X = x;
+    region.DimY = dimy;
+    region.DimX = dimx;
+    region.Z = z;
+    region.Order = NextOrder++;
+    region.Used = true;
+
+    link(id, true, gspan(region), Span());
+
+    return id;
+}
+
+bool npp::HitMap::remove(unsigned int id) {
+    if (id >= Regions.size() || !Regions[id].Used) {return false;}
+
+    link(id, false, gspan(Regions[id]), Span());
+    Regions[id].Used = false;
+    Free.push_back(id);
+
+    return true;
+}
+
+void npp::HitMap::clear() {
+    for (unsigned int i = 0; i < Buckets.size(); i++) {
+        Buckets[i].clear();
+    }
+    Regions.clear();
+    Free.clear();
+}
+
+bool npp::HitMap::umove(unsigned int id, unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx) {
+    if (id >= Regions.size() || !Regions[id].Used) {return false;}
+
+    Region &region = Regions[id];
+    if (region.Y == y && region.X == x && region.DimY == dimy && region.DimX == dimx) {return true;}
+
+    Span before = gspan(region);
+    region.Y = y;
+    region.X = x;
+    region.DimY = dimy;
+    region.DimX = dimx;
+    Span after = gspan(region);
+
+    // Buckets that the region stays in keep it, so only the ones it leaves or enters are touched
+    link(id, false, before, after);
+    link(id, true, after, before);
+
+    return true;
+}
+
+bool npp::HitMap::uz(unsigned int id, int z) {
+    if (id >= Regions.size() || !Regions[id].Used) {return false;}
+
+    // The buckets don't care about z, so nothing has to be relinked
+    Regions[id].Z = z;
+    Regions[id].Order = NextOrder++;
+
+    return true;
+}
+
+long npp::HitMap::ghit(unsigned short y, unsigned short x) {
+    if (y >= DimY || x >= DimX) {return -1;}
+
+    const std::vector<unsigned int> &bucket = Buckets[(y / BucketDim) * BucketsX + x / BucketDim];
+    long hit = -1;
+
+    for (unsigned int i = 0; i < bucket.size(); i++) {
+        const Region &region = Regions[bucket[i]];
+        if (y < region.Y || y >= region.Y + region.DimY || x < region.X || x >= region.X + region.DimX) {continue;}
+
+        if (hit < 0 || region.Z > Regions[hit].Z || (region.Z == Regions[hit].Z && region.Order > Regions[hit].Order)) {hit = bucket[i];}
+    }
+
+    return hit;
+}
+
+const unsigned int npp::HitMap::gcount() {return Regions.size() - Free.size();}
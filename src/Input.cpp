@@ -0,0 +1,285 @@
+#include "Input.hpp"
+
+npp::Input npp::minput;
+
+npp::Input::~Input() {stop();}
+
+bool npp::Input::start(bool useMouse, int fd) {
+    if (Running) {return false;}
+    // The reader thread may have ended on its own (like when the input is closed), in which case it still has to be cleaned up
+    stop();
+    if (pipe(Wake) != 0) {return false;}
+    if (pipe(Notify) != 0) {
+        close(Wake[0]);
+        close(Wake[1]);
+        Wake[0] = Wake[1] = -1;
+        return false;
+    }
+    // A full pipe already means the UI thread will wake up, so the reader never has to block on it
+    fcntl(Notify[0], F_SETFL, fcntl(Notify[0], F_GETFL) | O_NONBLOCK);
+    fcntl(Notify[1], F_SETFL, fcntl(Notify[1], F_GETFL) | O_NONBLOCK);
+
+    Fd = fd;
+    UseMouse = useMouse;
+    // Whatever the terminal sends for Backspace (usually ^? in raw mode) is what ncurses' keypad turns into KEY_BACKSPACE (there's no entry to look at without a terminal, like when headless)
+    char *kbs = tigetstr((char *)"kbs");
+    Backspace = (kbs != nullptr && kbs != (char *)-1 && kbs[0] != '\0' && kbs[1] == '\0') ? (unsigned char)kbs[0] : -1;
+    // SGR reports aren't limited to 223 rows/cols like the old X10 ones and say which button was released
+    if (UseMouse && ::write(STDOUT_FILENO, "\033[?1006h", 8) < 0) {}
+
+    Running = true;
+    Reader = std::thread(&Input::read, this);
+
+    return true;
+}
+
+void npp::Input::stop() {
+    if (!Reader.joinable()) {return;}
+
+    Running = false;
+    if (::write(Wake[1], "", 1) < 0) {}
+    Reader.join();
+
+    close(Wake[0]);
+    close(Wake[1]);
+    close(Notify[0]);
+    close(Notify[1]);
+    Wake[0] = Wake[1] = -1;
+    Notify[0] = Notify[1] = -1;
+
+    if (UseMouse && ::write(STDOUT_FILENO, "\033[?1006l", 8) < 0) {}
+}
+
+bool npp::Input::gevent(Event &event) {return Events.pop(event);}
+
+bool npp::Input::gevent(Event &event, int millis) {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(millis);
+
+    // The queue is always checked before sleeping, so an input that was pushed before its poke got drained can't be missed
+    while (!Events.pop(event)) {
+        if (!Running || Notify[0] < 0) {return false;}
+
+        long left = -1;
+        if (millis >= 0) {
+            // Rounded up so that the wait never ends a little early and spins
+            left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now() + std::chrono::microseconds(999)).count();
+            if (left <= 0) {return false;}
+        }
+
+        pollfd fd = {Notify[0], POLLIN, 0};
+        int ready = ::poll(&fd, 1, left);
+        if (ready < 0 && errno != EINTR) {return false;}
+
+        char pokes[64];
+        while (::read(Notify[0], pokes, sizeof(pokes)) > 0) {}
+    }
+
+    return true;
+}
+
+std::size_t npp::Input::drain(std::vector<Event> &events, std::size_t max, bool coalesce) {
+    Event event;
+    std::size_t start = events.size();
+    std::size_t count = 0;
+
+    while (count < max && Events.pop(event)) {
+        events.push_back(event);
+        count++;
+    }
+
+    if (coalesce) {count -= mmouse.coalesce(events, start);}
+
+    return count;
+}
+
+const bool npp::Input::grunning() {return Running;}
+const unsigned long npp::Input::gdropped() {return Dropped;}
+
+void npp::Input::read() {
+    unsigned char buffer[512];
+    std::size_t length = 0;
+
+    while (Running) {
+        pollfd fds[2] = {{Fd, POLLIN, 0}, {Wake[0], POLLIN, 0}};
+        // A lone escape could be the start of a sequence, so it only counts as the escape key once nothing follows it for a bit
+        int ready = ::poll(fds, 2, length > 0 ? 25 : -1);
+
+        if (ready < 0) {
+            if (errno == EINTR) {continue;}
+            break;
+        }
+        if (fds[1].revents) {break;}
+
+        if (ready == 0) {
+            // Whatever is left is an incomplete sequence that will never finish, so its first byte is passed along on its own
+            Event event;
+            event.Key = buffer[0] < 0x80 ? buffer[0] : 0xFFFD;
+            if (!Events.push(event)) {Dropped++;}
+            std::copy(buffer + 1, buffer + length, buffer);
+            length--;
+        } else {
+            ssize_t got = ::read(Fd, buffer + length, sizeof(buffer) - length);
+            if (got <= 0) {
+                if (got < 0 && (errno == EINTR || errno == EAGAIN)) {continue;}
+                break;
+            }
+            length += got;
+        }
+
+        std::size_t done = 0;
+        bool pushed = ready == 0;
+        while (done < length) {
+            Event event;
+            std::size_t used = decode(buffer + done, length - done, event);
+
+            if (used == 0) {
+                // A sequence this long isn't going to finish, so it's treated as garbage
+                if (length - done >= 64) {used = 1;}
+                else {break;}
+            }
+
+            done += used;
+            if (event.Key != ERR) {
+                if (Events.push(event)) {pushed = true;}
+                else {Dropped++;}
+            }
+        }
+
+        std::copy(buffer + done, buffer + length, buffer);
+        length -= done;
+
+        // One poke per batch is enough to wake the UI thread up (if the pipe is full, it's already going to wake up)
+        if (pushed && ::write(Notify[1], "", 1) < 0) {}
+    }
+
+    Running = false;
+    // Anything still waiting on an input gets woken up to see that there won't be any more
+    if (::write(Notify[1], "", 1) < 0) {}
+}
+
+std::size_t npp::Input::decode(const unsigned char *buffer, std::size_t length, Event &event) {
+    if (buffer[0] != 27) {
+        // A character that hasn't fully arrived yet is waited on, as long as the bytes so far could still make a valid one
+        unsigned char lead = buffer[0];
+        unsigned char bytes = lead < 0x80 ? 1 : lead < 0xC2 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+        if (length < bytes) {
+            bool partial = true;
+            for (std::size_t i = 1; i < length; i++) {
+                if ((buffer[i] & 0xC0) != 0x80) {partial = false;}
+            }
+            // The second byte is what rules out overlong encodings, surrogates and anything past U+10FFFF
+            if (length >= 2 && ((lead == 0xE0 && buffer[1] < 0xA0) || (lead == 0xED && buffer[1] > 0x9F) || (lead == 0xF0 && buffer[1] < 0x90) || (lead == 0xF4 && buffer[1] > 0x8F))) {partial = false;}
+            if (partial) {return 0;}
+        }
+
+        // Malformed bytes come through as U+FFFD one at a time, so they never swallow the keys after them
+        const unsigned char *input = buffer;
+        int code = decodeUtf8(input, buffer + length);
+
+        // Enter comes in as a carriage return in raw mode, but ncurses hands it over as a newline (and Backspace as KEY_BACKSPACE with the keypad on)
+        event.Key = code == '\r' ? '\n' : code == Backspace ? KEY_BACKSPACE : code;
+        return input - buffer;
+    }
+
+    if (length < 2) {return 0;}
+
+    // SS3 sequences (ESC O x)
+    if (buffer[1] == 'O') {
+        if (length < 3) {return 0;}
+
+        switch (buffer[2]) {
+            case 'A': event.Key = KEY_UP; break;
+            case 'B': event.Key = KEY_DOWN; break;
+            case 'C': event.Key = KEY_RIGHT; break;
+            case 'D': event.Key = KEY_LEFT; break;
+            case 'H': event.Key = KEY_HOME; break;
+            case 'F': event.Key = KEY_END; break;
+            case 'P': case 'Q': case 'R': case 'S': event.Key = KEY_F(buffer[2] - 'P' + 1); break;
+        }
+        return 3;
+    }
+
+    // Anything else after an escape (like alt + a key) is passed along as the escape key, followed by the rest on its own
+    if (buffer[1] != '[') {
+        event.Key = 27;
+        return 1;
+    }
+
+    // X10 mouse reports (ESC [ M b x y) have raw bytes instead of parameters
+    if (length >= 3 && buffer[2] == 'M') {
+        if (length < 6) {return 0;}
+
+        decodeMouse(buffer[3] - 32, buffer[5] - 32, buffer[4] - 32, false, event);
+        return 6;
+    }
+
+    // CSI sequences (ESC [ parameters final)
+    std::size_t end = 2;
+    while (end < length && (buffer[end] < 0x40 || buffer[end] > 0x7E)) {end++;}
+    if (end >= length) {return 0;}
+
+    unsigned int params[4] = {0, 0, 0, 0};
+    unsigned char count = 0;
+    for (std::size_t i = (buffer[2] == '<') ? 3 : 2; i < end; i++) {
+        if (buffer[i] >= '0' && buffer[i] <= '9') {
+            if (count == 0) {count = 1;}
+            params[count - 1] = params[count - 1] * 10 + (buffer[i] - '0');
+        } else if (buffer[i] == ';' && count < 4) {
+            count = count == 0 ? 2 : count + 1;
+        }
+    }
+
+    // SGR mouse reports (ESC [ < b ; x ; y M/m)
+    if (buffer[2] == '<') {
+        if (buffer[end] == 'M' || buffer[end] == 'm') {decodeMouse(params[0], params[2], params[1], buffer[end] == 'm', event);}
+        return end + 1;
+    }
+
+    switch (buffer[end]) {
+        case 'A': event.Key = KEY_UP; break;
+        case 'B': event.Key = KEY_DOWN; break;
+        case 'C': event.Key = KEY_RIGHT; break;
+        case 'D': event.Key = KEY_LEFT; break;
+        case 'H': event.Key = KEY_HOME; break;
+        case 'F': event.Key = KEY_END; break;
+        case 'Z': event.Key = KEY_BTAB; break;
+        case '~':
+            switch (params[0]) {
+                case 1: case 7: event.Key = KEY_HOME; break;
+                case 2: event.Key = KEY_IC; break;
+                case 3: event.Key = KEY_DC; break;
+                case 4: case 8: event.Key = KEY_END; break;
+                case 5: event.Key = KEY_PPAGE; break;
+                case 6: event.Key = KEY_NPAGE; break;
+                case 11: case 12: case 13: case 14: case 15: event.Key = KEY_F(params[0] - 10); break;
+                case 17: case 18: case 19: case 20: case 21: event.Key = KEY_F(params[0] - 11); break;
+                case 23: case 24: event.Key = KEY_F(params[0] - 12); break;
+            }
+            break;
+    }
+
+    return end + 1;
+}
+
+void npp::Input::decodeMouse(unsigned int button, unsigned int y, unsigned int x, bool release, Event &event) {
+    event.Key = KEY_MOUSE;
+    event.Y = y > 0 ? y - 1 : 0;
+    event.X = x > 0 ? x - 1 : 0;
+
+    // Same mapping as Mouse::gmouse(): the terminal's middle button is M3 and its right button is M2
+    static const char presses[3] = {M1_PRESS, M3_PRESS, M2_PRESS};
+
+    if (button & 64) {
+        // Scroll wheel (only the "presses" actually mean anything)
+        event.Button = (button & 3) == 0 ? M4_PRESS : (button & 3) == 1 ? M5_PRESS : M_UNKNOWN;
+    } else if (button & 32) {
+        // Motion (with or without a button held down)
+        event.Button = M_MOVE;
+    } else if ((button & 3) == 3 || release) {
+        // Every release code is exactly one after its press code
+        event.Button = ((button & 3) == 3 ? LastButton : presses[button & 3]) + 1;
+    } else {
+        LastButton = presses[button & 3];
+        event.Button = LastButton;
+    }
+}
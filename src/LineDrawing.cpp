@@ -0,0 +1,4 @@
+#include "LineDrawing.hpp"
+
+// Built entirely by the compiler, so there's nothing to set up at startup
+constexpr npp::PieceTable npp::mpieces;
@@ -0,0 +1,4 @@
+#include "MatrixText.hpp"
+
+// Built entirely by the compiler, so there's nothing to set up at startup
+constexpr npp::MatrixFont npp::mmatrix;
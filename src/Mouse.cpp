@@ -1,5 +1,7 @@
 #include "Mouse.hpp"
 
+npp::Mouse npp::mmouse;
+
 const char npp::Mouse::ginput() {
     return Button;
 }
@@ -16,9 +18,50 @@ const unsigned short npp::Mouse::gz() {
     return Z;
 }
 
-bool npp::Mouse::gmouse(int input) {
+const unsigned long npp::Mouse::graw() {
+    return Raw;
+}
+
+const unsigned long npp::Mouse::gdelivered() {
+    return Delivered;
+}
+
+bool npp::Mouse::gmouse(int input, WINDOW *win) {
+    // The input comes from minput while its thread is running, in which case gchar() has already updated the mouse from it
+    if (minput.grunning()) {return input == KEY_MOUSE;}
+
     MEVENT event;
     if (getmouse(&event) != OK) {return false;}
+    Raw++;
+
+    // Any motion queued up right behind this one is skipped over so that only the latest position gets handled
+    // (it's read through the window the input came from, since reading through another one would refresh that one over it)
+    if (win == nullptr) {win = Source;}
+    if ((event.bstate & REPORT_MOUSE_POSITION) && win != nullptr) {
+        MEVENT next;
+        bool hadKeypad = is_keypad(win), hadNodelay = is_nodelay(win);
+        keypad(win, true);
+        nodelay(win, true);
+
+        int queued;
+        while ((queued = wgetch(win)) == KEY_MOUSE) {
+            if (getmouse(&next) != OK) {continue;}
+            Raw++;
+
+            // Anything other than motion is put back for the next call, which keeps everything in order
+            if (!(next.bstate & REPORT_MOUSE_POSITION)) {
+                ungetmouse(&next);
+                Raw--;
+                break;
+            }
+            event = next;
+        }
+        if (queued != KEY_MOUSE && queued != ERR) {ungetch(queued);}
+
+        keypad(win, hadKeypad);
+        nodelay(win, hadNodelay);
+    }
+    Delivered++;
 
     // Change the janky ncurses values for the mouse into easier ones
     // Mouse 2 is actually bound to right click as well, not middle click
@@ -99,7 +142,7 @@ bool npp::Mouse::gmouse(int input) {
             Button = M5_TCLICK;
             break;
         default:
-            Button = M_UNKNOWN;
+            Button = (event.bstate & REPORT_MOUSE_POSITION) ? M_MOVE : M_UNKNOWN;
             break;
     }
 
@@ -109,3 +152,39 @@ bool npp::Mouse::gmouse(int input) {
 
     return true;
 }
+
+void npp::Mouse::usource(WINDOW *win) {Source = win;}
+
+bool npp::Mouse::gmouse(const Event &event) {
+    if (event.Key != KEY_MOUSE) {return false;}
+
+    Button = event.Button;
+    X = event.X;
+    Y = event.Y;
+    Z = 0;
+
+    return true;
+}
+
+std::size_t npp::Mouse::coalesce(std::vector<Event> &events, std::size_t start) {
+    // Find the latest motion first, since that's the only one worth keeping (events.size() means there isn't one)
+    std::size_t latest = events.size();
+    for (std::size_t i = start; i < events.size(); i++) {
+        if (events[i].Key != KEY_MOUSE) {continue;}
+
+        Raw++;
+        if (events[i].Button == M_MOVE) {latest = i;}
+    }
+
+    std::size_t kept = start;
+    for (std::size_t i = start; i < events.size(); i++) {
+        if (events[i].Key == KEY_MOUSE && events[i].Button == M_MOVE && i != latest) {continue;}
+        if (events[i].Key == KEY_MOUSE) {Delivered++;}
+        events[kept++] = events[i];
+    }
+
+    std::size_t removed = events.size() - kept;
+    events.resize(kept);
+
+    return removed;
+}
@@ -0,0 +1,94 @@
+#include "Palette.hpp"
+
+npp::Palette npp::mpalette;
+
+npp::Palette::Palette() {
+    Entries.push_back(Entry());
+    Used.push_back(false);
+    Index[Look()] = 0;
+}
+
+unsigned int npp::Palette::intern(unsigned char color, unsigned short attr, unsigned int fg, unsigned int bg, bool canMerge) {
+    Look look;
+    look.Color = color;
+    look.Attr = attr;
+    look.Fg = fg;
+    look.Bg = bg;
+
+    if (!(look == LastLook)) {
+        std::unordered_map<Look, unsigned int, Hash>::iterator found = Index.find(look);
+
+        if (found == Index.end()) {
+            Entry entry;
+            entry.Key = look;
+            entry.Attrs = (attr_t)attr << ATTR_SHIFT;
+
+            if (Free.empty()) {
+                LastIndex = Entries.size();
+                Entries.push_back(entry);
+                Used.push_back(false);
+            } else {
+                LastIndex = Free.back();
+                Free.pop_back();
+                Entries[LastIndex] = entry;
+            }
+            Index[look] = LastIndex;
+        } else {
+            LastIndex = found->second;
+        }
+        LastLook = look;
+    }
+
+    return LastIndex << 1 | (canMerge ? 1 : 0);
+}
+
+const npp::Look &npp::Palette::glook(unsigned int id) {return Entries[id >> 1].Key;}
+const attr_t npp::Palette::gattrs(unsigned int id) {return Entries[id >> 1].Attrs;}
+
+const int npp::Palette::gpair(unsigned int id) {
+    Entry &entry = Entries[id >> 1];
+    const Look &look = entry.Key;
+    if (!(look.Fg & RGB_SET) && !(look.Bg & RGB_SET)) {return entry.Pair = look.Color;}
+    if (entry.Pair >= 0 && entry.Checked == Frame) {return entry.Pair;}
+
+    // ncurses can't do 24-bit colors, so the closest of the 256 colors are used instead (the half not overridden comes from the look's pair)
+    short pairFg, pairBg;
+    if (pair_content(look.Color, &pairFg, &pairBg) != OK) {pairFg = 1; pairBg = 0;}
+    entry.Checked = Frame;
+
+    // alloc_pair() hands back the pair that already has these colors (marking it as recently used), and once every pair has been taken it recycles the least recently used one,
+    // so a pair that was cached for longer than a frame could have been given different colors in the meantime
+    int pair = alloc_pair((look.Fg & RGB_SET) ? rgbIndex(look.Fg) : pairFg, (look.Bg & RGB_SET) ? rgbIndex(look.Bg) : pairBg);
+
+    // Running out of pairs (or colors) falls back to the look's own pair
+    return entry.Pair = pair < 0 ? look.Color : pair;
+}
+
+void npp::Palette::uframe() {Frame++;}
+
+const bool npp::Palette::gmerge(unsigned int id) {return id & 1;}
+unsigned int npp::Palette::umerge(unsigned int id, bool canMerge) {return (id & ~1u) | (canMerge ? 1 : 0);}
+const unsigned int npp::Palette::gcount() {return Entries.size() - Free.size();}
+
+const bool npp::Palette::gcollect() {return gcount() >= Limit;}
+void npp::Palette::umark(unsigned int id) {Used[id >> 1] = true;}
+
+void npp::Palette::ucollect() {
+    // The default look is what blank cells use, so it's always kept
+    for (unsigned int i = 1; i < Entries.size(); i++) {
+        if (Entries[i].Live && !Used[i]) {
+            Index.erase(Entries[i].Key);
+            Entries[i].Live = false;
+            Free.push_back(i);
+            if (LastIndex == i) {
+                LastLook = Look();
+                LastIndex = 0;
+            }
+        }
+        Used[i] = false;
+    }
+    Used[0] = false;
+
+    // Collecting again every frame wouldn't get anywhere if most of the looks are still being used
+    if (gcount() >= Limit / 2) {Limit *= 2;}
+}
@@ -0,0 +1,238 @@
+#include "Terminal.hpp"
+
+npp::Terminal npp::mterm;
+
+void npp::Terminal::appendNum(unsigned int num) {
+    char digits[10];
+    unsigned char length = 0;
+
+    do {
+        digits[length++] = '0' + num % 10;
+        num /= 10;
+    } while (num > 0);
+
+    while (length > 0) {Buffer += digits[--length];}
+}
+
+void npp::Terminal::ubackend(unsigned char backend) {Backend = backend;}
+void npp::Terminal::uheadless(unsigned short dimy, unsigned short dimx) {
+    Backend = BACKEND_HEADLESS;
+    ScreenY = dimy;
+    ScreenX = dimx;
+    Screen.assign(dimy * dimx, ScreenCell());
+    Capture.clear();
+    invalidate();
+}
+void npp::Terminal::ufd(int fd) {
+    Fd = fd;
+    invalidate();
+}
+
+const unsigned char npp::Terminal::gbackend() {return Backend;}
+const unsigned short npp::Terminal::gdimy() {return Backend == BACKEND_HEADLESS ? ScreenY : LINES;}
+const unsigned short npp::Terminal::gdimx() {return Backend == BACKEND_HEADLESS ? ScreenX : COLS;}
+const unsigned long npp::Terminal::gbytes() {return Bytes;}
+const unsigned long npp::Terminal::gsyscalls() {return Syscalls;}
+
+const npp::ScreenCell npp::Terminal::gcell(unsigned short y, unsigned short x) {return (y >= ScreenY || x >= ScreenX) ? ScreenCell() : Screen[y * ScreenX + x];}
+const std::wstring npp::Terminal::grow(unsigned short y) {
+    std::wstring output;
+    if (y >= ScreenY) {return output;}
+
+    for (unsigned short x = 0; x < ScreenX; x++) {
+        output += Screen[y * ScreenX + x].Char;
+    }
+
+    return output;
+}
+const std::string &npp::Terminal::gcapture() {return Capture;}
+void npp::Terminal::clearCapture() {Capture.clear();}
+
+void npp::Terminal::move(unsigned short y, unsigned short x) {
+    if (CurY == y && CurX == x) {return;}
+
+    // CUP is 1-based
+    Buffer += "\033[";
+    appendNum(y + 1);
+    Buffer += ';';
+    appendNum(x + 1);
+    Buffer += 'H';
+
+    CurY = y;
+    CurX = x;
+}
+
+void npp::Terminal::style(unsigned short attr, unsigned char color, unsigned int fg, unsigned int bg) {
+    // Color pairs are looked up from ncurses so that pairs made with init_pair() look the same as they do through ncurses
+    if (!(fg & RGB_SET) || !(bg & RGB_SET)) {
+        short pairFg, pairBg;
+        pairColors(color, pairFg, pairBg);
+        fg = (fg & RGB_SET) ? fg : (pairFg < 0 ? COLOR_UNSET : pairFg);
+        bg = (bg & RGB_SET) ? bg : (pairBg < 0 ? COLOR_UNSET : pairBg);
+    }
+
+    if (StyleKnown && CurAttr == attr && CurFg == fg && CurBg == bg) {return;}
+
+    // The alternate character set is a switch of the character set (to DEC line drawing) rather than an SGR attribute
+    if (!StyleKnown || ((CurAttr ^ attr) & ATTR_ALTCHARSET)) {Buffer += (attr & ATTR_ALTCHARSET) ? "\033(0" : "\033(B";}
+
+    // Protected cells don't look any different on a terminal, so there's nothing to send for them
+    unsigned short curSgr = CurAttr & ~(ATTR_ALTCHARSET | ATTR_PROTECT), sgr = attr & ~(ATTR_ALTCHARSET | ATTR_PROTECT);
+    if (StyleKnown && curSgr == sgr && CurFg == fg && CurBg == bg) {
+        CurAttr = attr;
+        return;
+    }
+
+    // Attributes can only be turned off with a reset, which also resets the colors
+    bool reset = !StyleKnown || (curSgr & ~sgr);
+    unsigned short added = reset ? sgr : sgr & ~curSgr;
+
+    Buffer += "\033[";
+    std::size_t start = Buffer.length();
+    if (reset) {Buffer += '0';}
+    if (added & ATTR_BOLD) {Buffer += ";1";}
+    if (added & ATTR_DIM) {Buffer += ";2";}
+    if (added & ATTR_ITALIC) {Buffer += ";3";}
+    if (added & ATTR_UNDERLINE) {Buffer += ";4";}
+    if (added & ATTR_BLINK) {Buffer += ";5";}
+    if (added & (ATTR_REVERSE | ATTR_STANDOUT) && (reset || !(CurAttr & (ATTR_REVERSE | ATTR_STANDOUT)))) {Buffer += ";7";}
+    if (added & ATTR_INVIS) {Buffer += ";8";}
+    if (reset || CurFg != fg) {appendColor(fg, false);}
+    if (reset || CurBg != bg) {appendColor(bg, true);}
+    // Every parameter comes with a leading ';', and an empty first parameter would count as a reset
+    if (!reset) {Buffer.erase(start, 1);}
+    Buffer += 'm';
+
+    CurAttr = attr;
+    CurFg = fg;
+    CurBg = bg;
+    StyleKnown = true;
+}
+
+void npp::Terminal::pairColors(unsigned char color, short &fg, short &bg) {
+    // There's no ncurses screen to ask when headless, so the pairs are assumed to be the ones set up by init()
+    if (Backend == BACKEND_HEADLESS) {
+        fg = (color == 0) ? 1 : (color <= 8 ? color : 1);
+        bg = 0;
+        return;
+    }
+
+    // Every run of a frame needs its pair's colors, so ncurses is only asked once per pair per frame
+    if (!PairKnown[color]) {
+        if (pair_content(color, &PairFg[color], &PairBg[color]) != OK) {PairFg[color] = 1; PairBg[color] = 0;}
+        PairKnown[color] = true;
+    }
+    fg = PairFg[color];
+    bg = PairBg[color];
+}
+
+void npp::Terminal::appendColor(unsigned int color, bool background) {
+    if (color == COLOR_UNSET) {
+        Buffer += background ? ";49" : ";39";
+    } else if (color & RGB_SET) {
+        Buffer += background ? ";48;2;" : ";38;2;";
+        appendNum(color >> 16 & 0xFF);
+        Buffer += ';';
+        appendNum(color >> 8 & 0xFF);
+        Buffer += ';';
+        appendNum(color & 0xFF);
+    } else if (color < 8) {
+        Buffer += background ? ";4" : ";3";
+        appendNum(color);
+    } else {
+        Buffer += background ? ";48;5;" : ";38;5;";
+        appendNum(color);
+    }
+}
+
+void npp::Terminal::put(wchar_t ch) {
+    unsigned int code = ch;
+
+    if (Backend == BACKEND_HEADLESS && CurY >= 0 && CurY < ScreenY && CurX >= 0 && CurX < ScreenX) {
+        ScreenCell &cell = Screen[CurY * ScreenX + CurX];
+        cell.Char = ch;
+        cell.Attr = CurAttr;
+        cell.Fg = CurFg;
+        cell.Bg = CurBg;
+    }
+
+    if (code < 0x80) {
+        Buffer += (char)code;
+    } else if (code < 0x800) {
+        Buffer += (char)(0xC0 | (code >> 6));
+        Buffer += (char)(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        Buffer += (char)(0xE0 | (code >> 12));
+        Buffer += (char)(0x80 | ((code >> 6) & 0x3F));
+        Buffer += (char)(0x80 | (code & 0x3F));
+    } else {
+        Buffer += (char)(0xF0 | (code >> 18));
+        Buffer += (char)(0x80 | ((code >> 12) & 0x3F));
+        Buffer += (char)(0x80 | ((code >> 6) & 0x3F));
+        Buffer += (char)(0x80 | (code & 0x3F));
+    }
+
+    // Wide characters move the cursor by more than one column, so its position can't be trusted after one
+    if (CurX >= 0) {CurX = (code < 0x1100 || wcwidth(ch) == 1) ? CurX + 1 : -1;}
+}
+
+void npp::Terminal::erase(unsigned short y, unsigned short x, unsigned short length) {
+    if (length == 0) {return;}
+
+    // Erased cells take on the current background, so the colors and attributes go back to the terminal's defaults first
+    move(y, x);
+    if (!StyleKnown || (CurAttr & ~ATTR_ALTCHARSET) || CurFg != COLOR_UNSET || CurBg != COLOR_UNSET) {
+        Buffer += StyleKnown ? "\033[0m" : "\033(B\033[0m";
+        CurAttr = StyleKnown ? CurAttr & ATTR_ALTCHARSET : 0;
+        CurFg = CurBg = COLOR_UNSET;
+        StyleKnown = true;
+    }
+    Buffer += "\033[";
+    appendNum(length);
+    Buffer += 'X';
+
+    if (Backend == BACKEND_HEADLESS && y < ScreenY) {
+        for (unsigned short i = x; i < ScreenX && i < x + length; i++) {Screen[y * ScreenX + i] = ScreenCell();}
+    }
+}
+
+void npp::Terminal::invalidate() {
+    CurY = CurX = -1;
+    StyleKnown = false;
+}
+
+void npp::Terminal::flush() {
+    Bytes = Syscalls = 0;
+    std::fill(PairKnown, PairKnown + 256, false);
+
+    // Headless counts the single write(2) that a real terminal would have gotten
+    if (Backend == BACKEND_HEADLESS) {
+        Capture += Buffer;
+        Bytes = Buffer.length();
+        Syscalls = Buffer.empty() ? 0 : 1;
+        Buffer.clear();
+        return;
+    }
+
+    std::size_t done = 0;
+    while (done < Buffer.length()) {
+        ssize_t written = ::write(Fd, Buffer.data() + done, Buffer.length() - done);
+        Syscalls++;
+
+        if (written < 0) {
+            if (errno == EINTR) {continue;}
+            // A non-blocking terminal that's full is waited on instead of being hammered with writes until it drains
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                pollfd fd = {Fd, POLLOUT, 0};
+                if (::poll(&fd, 1, -1) >= 0 || errno == EINTR) {continue;}
+            }
+            // Whatever didn't make it out leaves the terminal in an unknown state
+            invalidate();
+            break;
+        }
+        done += written;
+    }
+
+    Bytes = done;
+    Buffer.clear();
+}
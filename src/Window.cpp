@@ -1,47 +1,115 @@
 #include "Window.hpp"
 
+npp::Window npp::mwin;
+
 //
 // INTERFACING WITH NCURSES
 //
 
-void npp::Window::write(unsigned short y, unsigned short x) {
+void npp::Window::write(unsigned short y, unsigned short x, unsigned short length) {
     // No printing characters outside of the ncurses window
     if (y < 0 || y >= DimY || x < 0 || x >= DimX) {return;}
+    unsigned short end = (x + length > DimX) ? DimX : x + length;
+    const Cell *cells = row(y);
+    Cell *front = Front.data() + y * DimX;
+
+    while (x < end) {
+        // Extend the run for as long as the cells look the same; wide characters end a run since they take up more than one column
+        unsigned short run = 1;
+        while (x + run < end && (cells[x + run - 1].Char < 0x1100 || wcwidth(cells[x + run - 1].Char) == 1) && sameStyle(cells[x + run], cells[x])) {
+            run++;
+        }
+
+        if (mterm.gbackend() != BACKEND_NCURSES) {
+            mterm.move(PosY + y, PosX + x);
+            const Look &look = mpalette.glook(cells[x].Style);
+            mterm.style(look.Attr, look.Color, look.Fg, look.Bg);
+            for (unsigned short i = 0; i < run; i++) {
+                mterm.put(cells[x + i].Char);
+            }
+        } else {
+            RunBuffer.clear();
+            for (unsigned short i = 0; i < run; i++) {
+                RunBuffer += cells[x + i].Char;
+            }
 
-    wattron(Win, COLOR_PAIR(Grid[y][x].Color));
-    toggleAttributes(Grid[y][x].Bold, Grid[y][x].Italic, Grid[y][x].Under, Grid[y][x].Rev, Grid[y][x].Blink, Grid[y][x].Dim, Grid[y][x].Invis, Grid[y][x].Stand, Grid[y][x].Prot, Grid[y][x].Alt);
+            // mvwaddnwstr() doesn't do any formatting, so '%' can sit in a run like any other character
+            // wattr_set() takes the pair separately, since pairs from alloc_pair() can be beyond what fits in COLOR_PAIR()
+            wattr_set(Win, cellAttributes(cells[x]), cellPair(cells[x]), NULL);
+            mvwaddnwstr(Win, y, x, RunBuffer.c_str(), run);
+        }
+        std::copy(cells + x, cells + x + run, front + x);
+        Stats.Runs++;
+        Stats.Cells += run;
 
-    if (Grid[y][x].Char == '%') {mvwprintw(Win, y, x, "%%");}
-    else {
-        std::wstring str; str += Grid[y][x].Char;
-        mvwaddwstr(Win, y, x, str.c_str());
+        x += run;
     }
 
-    wattroff(Win, COLOR_PAIR(Grid[y][x].Color));
-    toggleAttributes(Grid[y][x].Bold, Grid[y][x].Italic, Grid[y][x].Under, Grid[y][x].Rev, Grid[y][x].Blink, Grid[y][x].Dim, Grid[y][x].Invis, Grid[y][x].Stand, Grid[y][x].Prot, Grid[y][x].Alt);
+    if (mterm.gbackend() == BACKEND_NCURSES) {wattrset(Win, A_NORMAL);}
 }
 
-std::vector<bool> npp::Window::extractAttributes(std::string input) {
-    for (unsigned int i = 0; i < input.length(); i++) {
-        input[i] = tolower(input[i]);
+void npp::Window::present() {
+    if (mterm.gbackend() != BACKEND_NCURSES) {
+        mterm.flush();
+        ustats();
+    } else {
+        wrefresh(Win);
     }
+}
 
-    std::vector<bool> output = {false, false, false, false, false, false, false, false, false, false};
+void npp::Window::diff(unsigned short y, unsigned short x, unsigned short length) {
+    const Cell *back = row(y);
+    const Cell *front = Front.data() + y * DimX;
+    unsigned short end = (x + length > DimX) ? DimX : x + length;
 
-    if (input.find("bo") != std::string::npos) {output[0] = true;}
-    if (input.find("it") != std::string::npos) {output[1] = true;}
-    if (input.find("un") != std::string::npos) {output[2] = true;}
-    if (input.find("re") != std::string::npos) {output[3] = true;}
-    if (input.find("bl") != std::string::npos) {output[4] = true;}
-    if (input.find("di") != std::string::npos) {output[5] = true;}
-    if (input.find("in") != std::string::npos) {output[6] = true;}
-    if (input.find("st") != std::string::npos) {output[7] = true;}
-    if (input.find("pr") != std::string::npos) {output[8] = true;}
-    if (input.find("al") != std::string::npos) {output[9] = true;}
+    while (x < end) {
+        // Cells that already match what is on the screen don't need to be sent again
+        if (sameLook(back[x], front[x])) {x++; continue;}
 
-    return output;
+        unsigned short start = x;
+        while (x < end && !sameLook(back[x], front[x])) {x++;}
+        write(y, start, x - start);
+    }
+}
+
+void npp::Window::flushDamage() {
+    // A frame is the only point where every style ID in use is sitting in a window
+    if (mpalette.gcollect()) {collectStyles();}
+    mpalette.uframe();
+    for (unsigned short i = 0; i < DimY; i++) {
+        // Rows that haven't changed since the last render can be skipped entirely
+        if (Damage[i].first > Damage[i].second) {continue;}
+
+        diff(i, Damage[i].first, Damage[i].second - Damage[i].first + 1);
+        Damage[i] = {DimX, 0};
+    }
 }
 
+std::vector<npp::Window*> &npp::Window::gwindows() {
+    static std::vector<Window*> windows;
+    return windows;
+}
+
+void npp::Window::collectStyles() {
+    for (Window *win : gwindows()) {
+        for (const Cell &cell : win->Grid) {mpalette.umark(cell.Style);}
+        for (const Cell &cell : win->Front) {mpalette.umark(cell.Style);}
+        for (const std::pair<const std::string, TextBlock> &block : win->TextCache) {
+            for (const Cell &cell : block.second.Cells) {mpalette.umark(cell.Style);}
+        }
+        for (const NumField &field : win->Fields) {
+            if (field.Active) {mpalette.umark(field.Style);}
+        }
+    }
+    mpalette.ucollect();
+}
+
+bool npp::Window::sameStyle(const Cell &a, const Cell &b) {return (a.Style >> 1) == (b.Style >> 1);}
+bool npp::Window::sameLook(const Cell &a, const Cell &b) {return a.Char == b.Char && sameStyle(a, b);}
+
+attr_t npp::Window::cellAttributes(const Cell &cell) {return mpalette.gattrs(cell.Style);}
+int npp::Window::cellPair(const Cell &cell) {return mpalette.gpair(cell.Style);}
+
 void npp::Window::toggleAttributes(bool bold, bool italic, bool under, bool rev, bool blink, bool dim, bool invis, bool stand, bool prot, bool alt) {
     if (bold) {wattron(Win, A_BOLD);}
     else {wattroff(Win, A_BOLD);}
@@ -64,9 +132,9 @@ void npp::Window::toggleAttributes(bool bold, bool italic, bool under, bool rev,
     if (alt) {wattron(Win, A_ALTCHARSET);}
     else {wattroff(Win, A_ALTCHARSET);}
 }
-void npp::Window::toggleAttributes(std::string input) {
-    std::vector<bool> att = extractAttributes(input);
-    toggleAttributes(att[0], att[1], att[2], att[3], att[4], att[5], att[6], att[7], att[8], att[9]);
+void npp::Window::toggleAttributes(TextStyle input) {
+    unsigned short att = input.Attr;
+    toggleAttributes(att & ATTR_BOLD, att & ATTR_ITALIC, att & ATTR_UNDERLINE, att & ATTR_REVERSE, att & ATTR_BLINK, att & ATTR_DIM, att & ATTR_INVIS, att & ATTR_STANDOUT, att & ATTR_PROTECT, att & ATTR_ALTCHARSET);
 }
 
 //
@@ -74,14 +142,76 @@ void npp::Window::toggleAttributes(std::string input) {
 //
 
 bool npp::Window::wait(unsigned long millis) {
-    for (unsigned long i = 0; i < millis; i++) {
-        if (CanSkip) {
-            if (gchar(false, true, false) != ERR) {return true;}
+    // There's no one watching (or typing) when headless, so animations run as fast as they can
+    if (mterm.gbackend() == BACKEND_HEADLESS) {return false;}
+
+    if (!CanSkip || millis == 0) {
+        napms(millis);
+        return false;
+    }
+
+    return waitInput(std::chrono::steady_clock::now() + std::chrono::milliseconds(millis)) != ERR;
+}
+
+int npp::Window::waitInput(std::chrono::steady_clock::time_point deadline) {
+    // The input thread owns stdin while it's running, so reading it here as well would race it for the same bytes
+    if (minput.grunning()) {
+        long left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now() + std::chrono::microseconds(999)).count();
+        Event event;
+        if (left <= 0 || !minput.gevent(event, left)) {return ERR;}
+
+        mmouse.gmouse(event);
+        return event.Key;
+    }
+
+    keypad(Win, true);
+    nodelay(Win, true);
+
+    while (true) {
+        // ncurses may already be holding onto input that it read earlier, which poll() wouldn't see
+        int input = wgetch(Win);
+        if (input == KEY_MOUSE) {mmouse.usource(Win);}
+        if (input != ERR) {return input;}
+
+        // Rounded up so that the wait never ends a little early and spins
+        long left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now() + std::chrono::microseconds(999)).count();
+        if (left <= 0) {return ERR;}
+
+        pollfd fd = {STDIN_FILENO, POLLIN, 0};
+        int ready = poll(&fd, 1, left);
+
+        if (ready == 0) {return ERR;}
+        if (ready < 0 && errno != EINTR) {
+            // Input can't be waited on, so the rest of the time is just slept through
+            napms(left);
+            return ERR;
         }
-        napms(1);
     }
+}
 
-    return false;
+//
+// GRID ACCESS
+//
+
+npp::Window::Cell &npp::Window::cellAt(unsigned short y, unsigned short x) {return Grid[y * DimX + x];}
+npp::Window::Cell *npp::Window::row(unsigned short y) {return Grid.data() + y * DimX;}
+
+//
+// DAMAGE TRACKING
+//
+
+void npp::Window::damage(unsigned short y, unsigned short x, unsigned short length) {
+    if (!checkCoord(y, x) || length < 1) {return;}
+
+    unsigned short last = (x + length > DimX) ? DimX - 1 : x + length - 1;
+    Damage[y].first = (x < Damage[y].first) ? x : Damage[y].first;
+    Damage[y].second = (last > Damage[y].second) ? last : Damage[y].second;
+}
+
+void npp::Window::damageAll() {
+    for (unsigned short i = 0; i < DimY; i++) {
+        Damage[i] = {0, DimX - 1};
+    }
 }
 
 //
@@ -102,67 +232,101 @@ const unsigned char npp::Window::getConnectStyle(unsigned short y, unsigned shor
     // then there must not be something to connect with (even if the targeted cell is a box drawing element)
     if (!smerge(y, x)) {return 0;}
     
-    wchar_t character = schar(y, x);
-    for (unsigned char i = 0; i < Keys.LineDrawing.size(); i++) {
-        if (character == Keys.LineDrawing[i].first) {return Keys.LineDrawing[i].second[dir];}
+    return mpieces.gdirs(schar(y, x)) >> (6 - dir * 2) & 3;
+}
+
+const wchar_t npp::Window::getPiece(const unsigned char (&dir)[4], std::pair<unsigned char, unsigned char> style) {
+    return (style.first >= 8 || style.second >= 6) ? L' ' : mpieces.gpiece(packDirs(dir[0], dir[1], dir[2], dir[3]), style.first, style.second);
+}
+const unsigned char npp::Window::getLineStyle(unsigned char style, bool vertical) {
+    switch (style) {
+        case HEAVY_BOTH:
+            return STYLE_HEAVY;
+        case HEAVY_HORIZONTAL:
+            return vertical ? STYLE_LIGHT : STYLE_HEAVY;
+        case HEAVY_VERTICAL:
+            return vertical ? STYLE_HEAVY : STYLE_LIGHT;
+        case DOUBLED_BOTH:
+            return STYLE_DOUBLED;
+        case DOUBLED_HORIZTONAL:
+            return vertical ? STYLE_LIGHT : STYLE_DOUBLED;
+        case DOUBLED_VERTICAL:
+            return vertical ? STYLE_DOUBLED : STYLE_LIGHT;
     }
 
-    return 0;
+    return STYLE_LIGHT;
 }
 
-const wchar_t npp::Window::getPiece(std::vector<unsigned char> dir, std::pair<unsigned char, unsigned char> style) {
-    for (unsigned char i = 0; i < Keys.LineDrawing.size(); i++) {
-        if (dir == Keys.LineDrawing[i].second) {
-            // Vertical and horizontal lines (except for the doubled styles)
-            if (i < 24) {
-                if (style.first == HEAVY_HORIZONTAL) {return Keys.LineDrawing[i == 18 ? 12 + style.second : i + style.second].first;}
-                else if (style.first == HEAVY_VERTICAL) {return Keys.LineDrawing[i == 6 ? style.second : i + style.second].first;}
-                
-                return Keys.LineDrawing[i + style.second].first;
-            }
-            // Vertical and horizontal lines for the doubled styles (they don't have dashed variants so are on their own)
-            else if (i < 26) {
-                if (style.first == DOUBLED_HORIZTONAL) {return Keys.LineDrawing[i == 24 ? i : style.second].first;}
-                else if (style.first == DOUBLED_VERTICAL) {return Keys.LineDrawing[i == 24 ? 12 + style.second : i].first;}
+void npp::Window::composeGrid(unsigned short y, unsigned short x, const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {
+    style.first = (style.first < 0 || style.first >= 8) ? LIGHT_HARD : style.first;
+    style.second = (style.second < 0 || style.second >= 6) ? DASHED_NONE : style.second;
 
-                return Keys.LineDrawing[i].first;
-            }
-            // Corner pieces for the LIGHT_HARD and LIGHT_SOFT styles
-            else if (i < 33) {
-                return Keys.LineDrawing[i + (style.first == LIGHT_SOFT ? 1 : 0)].first;
+    std::pair<unsigned short, unsigned short> dims = gGridDims(rowDims, colDims);
+    unsigned char hstyle = getLineStyle(style.first, false), vstyle = getLineStyle(style.first, true);
+
+    // Which rows have a horizontal line and which cols have a vertical line
+    std::vector<bool> &lineY = GridLinesY, &lineX = GridLinesX;
+    lineY.assign(dims.first, false);
+    lineX.assign(dims.second, false);
+    for (unsigned short i = 0, pos = 0; i <= rowDims.size(); pos += (i < rowDims.size() ? rowDims[i] : 0) + 1, i++) {lineY[pos] = true;}
+    for (unsigned short i = 0, pos = 0; i <= colDims.size(); pos += (i < colDims.size() ? colDims[i] : 0) + 1, i++) {lineX[pos] = true;}
+
+    unsigned char dirs[4];
+    for (unsigned short gy = 0; gy < dims.first; gy++) {
+        for (unsigned short gx = 0; gx < dims.second; gx++) {
+            // Cells between the lines aren't part of the grid
+            if (!lineY[gy] && !lineX[gx]) {continue;}
+            if (!checkCoord(y + gy, x + gx)) {continue;}
+
+            // Connections that run along the grid's own lines are known up front
+            dirs[DIR_UP] = (lineX[gx] && gy > 0) ? vstyle : STYLE_NONE;
+            dirs[DIR_DOWN] = (lineX[gx] && gy < dims.first - 1) ? vstyle : STYLE_NONE;
+            dirs[DIR_LEFT] = (lineY[gy] && gx > 0) ? hstyle : STYLE_NONE;
+            dirs[DIR_RIGHT] = (lineY[gy] && gx < dims.second - 1) ? hstyle : STYLE_NONE;
+
+            // The rest connect to pre-existing lines, as long as the neighbour isn't a part of the grid (which would still hold whatever was there before)
+            if (canMerge) {
+                if (dirs[DIR_UP] == STYLE_NONE && (gy == 0 || (!lineY[gy - 1] && !lineX[gx]))) {dirs[DIR_UP] = getConnectStyle(y + gy - 1, x + gx, DIR_DOWN);}
+                if (dirs[DIR_DOWN] == STYLE_NONE && (gy == dims.first - 1 || (!lineY[gy + 1] && !lineX[gx]))) {dirs[DIR_DOWN] = getConnectStyle(y + gy + 1, x + gx, DIR_UP);}
+                if (dirs[DIR_LEFT] == STYLE_NONE && (gx == 0 || (!lineY[gy] && !lineX[gx - 1]))) {dirs[DIR_LEFT] = getConnectStyle(y + gy, x + gx - 1, DIR_RIGHT);}
+                if (dirs[DIR_RIGHT] == STYLE_NONE && (gx == dims.second - 1 || (!lineY[gy] && !lineX[gx + 1]))) {dirs[DIR_RIGHT] = getConnectStyle(y + gy, x + gx + 1, DIR_LEFT);}
             }
 
-            return Keys.LineDrawing[i].first;
+            wchar(y + gy, x + gx, getPiece(dirs, style), color);
+            cellAt(y + gy, x + gx).Style = mpalette.umerge(cellAt(y + gy, x + gx).Style, mergeable);
         }
     }
-
-    return L' ';
 }
 
-npp::Window::Window(unsigned short y = 0, unsigned short x = 0, unsigned short dimy = LINES, unsigned short dimx = COLS) {
+npp::Window::Window(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx) {
     // Prevent the window from being made out of bounds (and automatically resize ones that may)
-    y = (y < 0 || y >= LINES) ? 0 : y;
-    x = (x < 0 || x >= COLS) ? 0 : x;
-    dimy = (dimy < 1 || LINES - dimy - y < 0) ? LINES - y : dimy;
-    dimx = (dimx < 1 || COLS - dimx - x < 0) ? COLS - x : dimx;
-
-    Win = newwin(dimy, dimx, y, x);
+    // (the screen is the simulated one when headless, where LINES and COLS are never set)
+    unsigned short lines = mterm.gdimy(), cols = mterm.gdimx();
+    y = (y < 0 || y >= lines) ? 0 : y;
+    x = (x < 0 || x >= cols) ? 0 : x;
+    dimy = (dimy < 1 || lines - dimy - y < 0) ? lines - y : dimy;
+    dimx = (dimx < 1 || cols - dimx - x < 0) ? cols - x : dimx;
+
+    Win = (mterm.gbackend() == BACKEND_HEADLESS) ? nullptr : newwin(dimy, dimx, y, x);
     PosY = y;
     PosX = x;
     DimY = dimy;
     DimX = dimx;
 
-    for (unsigned short i = 0; i < DimY; i++) {
-        Grid.emplace_back();
-        for (unsigned short j = 0; j < DimX; j++) {
-            Grid[i].emplace_back();
-        }
-    }
+    // A fresh ncurses window is blank, which is what the front buffer starts out as
+    Grid.assign(DimY * DimX, Cell());
+    Front.assign(DimY * DimX, Cell());
+
+    // The first frame has to compare everything
+    Damage.assign(DimY, {0, DimX - 1});
+
+    gwindows().push_back(this);
 }
 npp::Window::Window(unsigned short dimy, unsigned short dimx) {
-    unsigned short y = LINES / 2 - dimy / 2;
-    unsigned short x = COLS / 2 - dimx / 2;
+    unsigned short y = mterm.gdimy() / 2 - dimy / 2;
+    unsigned short x = mterm.gdimx() / 2 - dimx / 2;
     Window(y, x, dimy, dimx);
+    gwindows().push_back(this);
 }
 npp::Window::Window(Window &win, unsigned short dimy, unsigned short dimx) {
     dimy = (win.gdimy() < dimy) ? win.gdimy() : dimy;
@@ -170,6 +334,15 @@ npp::Window::Window(Window &win, unsigned short dimy, unsigned short dimx) {
     unsigned short y = win.gposy() + win.gdimy() / 2 - dimy / 2;
     unsigned short x = win.gposx() + win.gdimx() / 2 - dimx / 2;
     Window(y, x, dimy, dimx);
+    gwindows().push_back(this);
+}
+npp::Window::Window(const Window &win) {
+    *this = win;
+    gwindows().push_back(this);
+}
+npp::Window::~Window() {
+    std::vector<Window*> &windows = gwindows();
+    windows.erase(std::remove(windows.begin(), windows.end(), this), windows.end());
 }
 
 //
@@ -177,47 +350,51 @@ npp::Window::Window(Window &win, unsigned short dimy, unsigned short dimx) {
 //
 
 int npp::Window::rwait(unsigned long millis) {
-    int input;
-
-    for (unsigned long i = 0; i < millis; i++) {
-        if (CanSkip) {
-            input = gchar(false, true, false);
+    if (mterm.gbackend() == BACKEND_HEADLESS) {return -1;}
 
-            if (input != ERR) {return input;}
-        }
-        napms(1);
+    if (!CanSkip || millis == 0) {
+        napms(millis);
+        return -1;
     }
 
-    return -1;
+    int input = waitInput(std::chrono::steady_clock::now() + std::chrono::milliseconds(millis));
+    return input == ERR ? -1 : input;
 }
 
 bool npp::Window::twait(unsigned long millis, std::vector<char> targets) {
-    int input;
+    if (mterm.gbackend() == BACKEND_HEADLESS) {return false;}
 
-    for (unsigned long i = 0; i < millis; i++) {
-        if (CanSkip) {
-            input = gchar(false, true, false);
+    if (!CanSkip || millis == 0) {
+        napms(millis);
+        return false;
+    }
 
-            if (input != ERR) {
-                for (unsigned short j = 0; j < targets.size(); j++) {
-                    if (input == targets[j]) {return true;}
-                }
-            }
+    // Inputs that aren't targets are thrown away, but the deadline stays the same
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(millis);
+    int input;
+
+    while ((input = waitInput(deadline)) != ERR) {
+        for (unsigned short j = 0; j < targets.size(); j++) {
+            if (input == targets[j]) {return true;}
         }
-        napms(1);
     }
 
     return false;
 }
 
 void npp::Window::uskip(bool skippable) {CanSkip = skippable;}
+const bool npp::Window::gskip() {return CanSkip;}
+void npp::Window::utextcache(unsigned short size) {
+    TextCacheSize = size;
+    trimText(size);
+}
 
 void npp::Window::upreset() {PadUp = PadDown = PadLeft = PadRight = 0;}
-void npp::Window::upup(unsigned short padding = 0) {PadUp = padding < 0 ? PadUp : padding;}
-void npp::Window::updown(unsigned short padding = 0) {PadDown = padding < 0 ? PadDown : padding;}
-void npp::Window::upleft(unsigned short padding = 0) {PadLeft = padding < 0 ? PadLeft : padding;}
-void npp::Window::upright(unsigned short padding = 0) {PadRight = padding < 0 ? PadRight : padding;}
-void npp::Window::upall(unsigned short padding = 0) {if (padding >= 0) {PadUp = PadDown = PadLeft = PadRight = padding;}}
+void npp::Window::upup(unsigned short padding) {PadUp = padding < 0 ? PadUp : padding;}
+void npp::Window::updown(unsigned short padding) {PadDown = padding < 0 ? PadDown : padding;}
+void npp::Window::upleft(unsigned short padding) {PadLeft = padding < 0 ? PadLeft : padding;}
+void npp::Window::upright(unsigned short padding) {PadRight = padding < 0 ? PadRight : padding;}
+void npp::Window::upall(unsigned short padding) {if (padding >= 0) {PadUp = PadDown = PadLeft = PadRight = padding;}}
 
 //
 // GETTING WINDOW/CELL ATTRIBUTES
@@ -231,122 +408,310 @@ const unsigned short npp::Window::gpadt() {return PadUp;}
 const unsigned short npp::Window::gpadb() {return PadDown;}
 const unsigned short npp::Window::gpadl() {return PadLeft;}
 const unsigned short npp::Window::gpadr() {return PadRight;}
+const npp::FrameStats npp::Window::gstats() {return Stats;}
+const npp::TextCacheStats npp::Window::gtextcache() {
+    TextStats.Blocks = TextCache.size();
+    return TextStats;
+}
 
-const wchar_t npp::Window::schar(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? L' ' : Grid[y][x].Char;}
-const unsigned char npp::Window::scolor(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? 1 : Grid[y][x].Color;}
-const bool npp::Window::sbold(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Bold;}
-const bool npp::Window::sitalic(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Italic;}
-const bool npp::Window::sunder(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Under;}
-const bool npp::Window::srev(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Rev;}
-const bool npp::Window::sblink(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Blink;}
-const bool npp::Window::sdim(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Dim;}
-const bool npp::Window::sinvis(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Invis;}
-const bool npp::Window::sstand(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Stand;}
-const bool npp::Window::sprot(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].Prot;}
-const bool npp::Window::salt(unsigned short y, unsigned short x) {return  !checkCoord(y, x) ? false : Grid[y][x].Alt;}
-const bool npp::Window::smerge(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : Grid[y][x].CanMerge;}
+const wchar_t npp::Window::schar(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? L' ' : cellAt(y, x).Char;}
+const unsigned char npp::Window::scolor(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? 1 : mpalette.glook(cellAt(y, x).Style).Color;}
+const unsigned int npp::Window::sfg(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? 0 : mpalette.glook(cellAt(y, x).Style).Fg;}
+const unsigned int npp::Window::sbg(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? 0 : mpalette.glook(cellAt(y, x).Style).Bg;}
+const bool npp::Window::sbold(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_BOLD) != 0;}
+const bool npp::Window::sitalic(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_ITALIC) != 0;}
+const bool npp::Window::sunder(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_UNDERLINE) != 0;}
+const bool npp::Window::srev(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_REVERSE) != 0;}
+const bool npp::Window::sblink(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_BLINK) != 0;}
+const bool npp::Window::sdim(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_DIM) != 0;}
+const bool npp::Window::sinvis(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_INVIS) != 0;}
+const bool npp::Window::sstand(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_STANDOUT) != 0;}
+const bool npp::Window::sprot(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_PROTECT) != 0;}
+const bool npp::Window::salt(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : (mpalette.glook(cellAt(y, x).Style).Attr & ATTR_ALTCHARSET) != 0;}
+const bool npp::Window::smerge(unsigned short y, unsigned short x) {return !checkCoord(y, x) ? false : mpalette.gmerge(cellAt(y, x).Style);}
 
 //
 // WRITING TO WINDOW
 //
 
-void npp::Window::clear() {wclear(Win);}
-void npp::Window::reset() {
-    for (unsigned short i = 0; i < DimY; i++) {
-        for (unsigned short j = 0; j < DimX; j++) {
-            Grid[i][j] = Cell();
-        }
+void npp::Window::clear() {
+    // The cell data is kept, so all of it has to be compared again on the next render
+    if (mterm.gbackend() != BACKEND_NCURSES) {
+        // Nothing on the screen can be trusted, so the front buffer is filled with cells that never match and everything gets written again
+        Cell unknown;
+        unknown.Char = L'\0';
+        std::fill(Front.begin(), Front.end(), unknown);
+        mterm.invalidate();
+
+        // The window's part of the screen is blanked as well (on the next flush), since whatever else left text there isn't in either buffer
+        for (unsigned short y = 0; y < DimY; y++) {mterm.erase(PosY + y, PosX, DimX);}
+    } else {
+        // The screen is blank after wclear(), just like a fresh front buffer
+        wclear(Win);
+        std::fill(Front.begin(), Front.end(), Cell());
     }
-    wclear(Win);
+    damageAll();
+}
+void npp::Window::reset() {
+    // The screen isn't cleared here; the next render only writes the cells that were actually changed by the reset
+    std::fill(Grid.begin(), Grid.end(), Cell());
+    damageAll();
+
+    // Numeric fields were wiped along with everything else, so their next values are written in full
+    for (NumField &field : Fields) {field.Length = 0;}
+}
+
+void npp::Window::putCell(unsigned short y, unsigned short x, wchar_t input, unsigned int style) {
+    Cell &cell = cellAt(y, x);
+    cell.Char = input;
+    cell.Style = style;
+
+    damage(y, x);
 }
 
-std::pair<unsigned short, unsigned short> npp::Window::wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {
+std::pair<unsigned short, unsigned short> npp::Window::wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {
     if (!checkCoord(pos)) {return pos;}
 
-    std::vector<bool> attributes = extractAttributes(att);
+    putCell(pos.first, pos.second, input, mpalette.intern(color, att.Attr));
 
-    Grid[pos.first][pos.second].Char = input;
-    Grid[pos.first][pos.second].Color = color;
-    
-    Grid[pos.first][pos.second].Bold = attributes[0];
-    Grid[pos.first][pos.second].Italic = attributes[1];
-    Grid[pos.first][pos.second].Under = attributes[2];
-    Grid[pos.first][pos.second].Rev = attributes[3];
-    Grid[pos.first][pos.second].Blink = attributes[4];
-    Grid[pos.first][pos.second].Dim = attributes[5];
-    Grid[pos.first][pos.second].Invis = attributes[6];
-    Grid[pos.first][pos.second].Stand = attributes[7];
-    Grid[pos.first][pos.second].Prot = attributes[8];
-    Grid[pos.first][pos.second].Alt = attributes[9];
-
-    Grid[pos.first][pos.second].CanMerge = false;
+    return {pos.first + offset.first, pos.second + offset.second};
+}
+std::pair<unsigned short, unsigned short> npp::Window::wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wcharp({y, x}, input, color, att, offset);}
+unsigned short npp::Window::wchary(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wcharp(pos, input, color, att, offset).first;}
+unsigned short npp::Window::wchary(unsigned short y, unsigned short x, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wchary({y, x}, input, color, att, offset);}
+unsigned short npp::Window::wcharx(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wcharp(pos, input, color, att, offset).second;}
+unsigned short npp::Window::wcharx(unsigned short y, unsigned short x, wchar_t input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wcharx({y, x}, input, color, att, offset);}
+void npp::Window::wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color, TextStyle att) {wcharp(pos, input, color, att, {0, 0});}
+void npp::Window::wchar(unsigned short y, unsigned short x, wchar_t input, unsigned char color, TextStyle att) {wchar({y, x}, input, color, att);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wcharp(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset) {
+    if (!checkCoord(pos)) {return pos;}
+
+    putCell(pos.first, pos.second, input, mpalette.intern(Defaults.Color, att.Attr, fg, bg));
 
     return {pos.first + offset.first, pos.second + offset.second};
 }
-std::pair<unsigned short, unsigned short> npp::Window::wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {return wcharp({y, x}, input, color, att, offset);}
-unsigned short npp::Window::wchary(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {return wcharp(pos, input, color, att, offset).first;}
-unsigned short npp::Window::wchary(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {return wchary({y, x}, input, color, att, offset);}
-unsigned short npp::Window::wcharx(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {return wcharp(pos, input, color, att, offset).second;}
-unsigned short npp::Window::wcharx(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset) {return wcharx({y, x}, input, color, att, offset);}
-void npp::Window::wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes) {wcharp(pos, input, color, att, {0, 0});}
-void npp::Window::wchar(unsigned short y, unsigned short x, wchar_t input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes) {wchar({y, x}, input, color, att);}
+std::pair<unsigned short, unsigned short> npp::Window::wcharp(unsigned short y, unsigned short x, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset) {return wcharp({y, x}, input, fg, bg, att, offset);}
+void npp::Window::wchar(std::pair<unsigned short, unsigned short> pos, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att) {wcharp(pos, input, fg, bg, att, {0, 0});}
+void npp::Window::wchar(unsigned short y, unsigned short x, wchar_t input, unsigned int fg, unsigned int bg, TextStyle att) {wchar({y, x}, input, fg, bg, att);}
 
-std::pair<unsigned short, unsigned short> npp::Window::wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {
+std::pair<unsigned short, unsigned short> npp::Window::wstrcore(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int style, std::pair<unsigned short, unsigned short> offset, bool wrap) {
     if (!checkCoord(pos)) {return pos;}
 
-    unsigned short yoffset = 0, xoffset = 0;
-    for (unsigned short i = 0; i < input.length(); i++) {
+    unsigned short yoffset = 0, xoffset = 0, x = pos.second;
+    for (unsigned int i = 0; i < input.length();) {
         // Automatically wrap the string back to the starting x-pos
-        if (pos.second + i - xoffset >= DimX) {
+        if (x >= DimX) {
             yoffset++;
             xoffset += ((wrap) ? (DimX - pos.second) : DimX);
+            x = pos.second + i - xoffset;
         }
 
         // Quit early if the string goes out of bounds
-        if (!checkCoord(pos.first + yoffset, pos.second + i - xoffset)) {break;}
+        if (!checkCoord(pos.first + yoffset, x)) {break;}
+
+        // Whatever fits on the rest of the row goes straight into it
+        unsigned short length = std::min<unsigned int>(input.length() - i, DimX - x);
+        Cell *cells = row(pos.first + yoffset) + x;
+        for (unsigned short j = 0; j < length; j++) {
+            cells[j].Char = input[i + j];
+            cells[j].Style = style;
+        }
+        damage(pos.first + yoffset, x, length);
 
-        wchar(pos.first + yoffset, pos.second + i - xoffset, input[i], color, att);
+        i += length;
+        x += length;
     }
 
     return {pos.first + yoffset + offset.first, pos.second + input.length() - 1 - xoffset + offset.second};
 }
-std::pair<unsigned short, unsigned short> npp::Window::wstrp(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wstrp({y, x}, input, color, att, offset, wrap);}
-unsigned short npp::Window::wstry(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wstrp(pos, input, color, att, offset, wrap).first;}
-unsigned short npp::Window::wstry(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wstry({y, x}, input, color, att, offset, wrap);}
-unsigned short npp::Window::wstrx(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wstrp(pos, input, color, att, offset, wrap).second;}
-unsigned short npp::Window::wstrx(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wstrx({y, x}, input, color, att, offset, wrap);}
-void npp::Window::wstr(std::pair<unsigned short, unsigned short> pos, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap) {wstrp(pos, input, color, att, {0, 0}, wrap);}
-void npp::Window::wstr(unsigned short y, unsigned short x, std::wstring input, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap) {wstr({y, x}, input, color, att, wrap);}
 
-std::pair<unsigned short, unsigned short> npp::Window::wintp(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {
+std::pair<unsigned short, unsigned short> npp::Window::wstrcore(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int style, std::pair<unsigned short, unsigned short> offset, bool wrap) {
     if (!checkCoord(pos)) {return pos;}
 
-    // Convert number to a string that can be written to the window
-    std::wstring num = std::to_wstring(input);
-    unsigned short length = num.length();
+    const unsigned char *in = (const unsigned char *)input.data(), *end = in + input.length();
+    unsigned short yoffset = 0, xoffset = 0, x = pos.second;
+    unsigned int i = 0;
+    while (in < end) {
+        // Automatically wrap the string back to the starting x-pos
+        if (x >= DimX) {
+            yoffset++;
+            xoffset += ((wrap) ? (DimX - pos.second) : DimX);
+            x = pos.second + i - xoffset;
+        }
+
+        // Quit early if the string goes out of bounds
+        if (!checkCoord(pos.first + yoffset, x)) {break;}
+
+        // Whatever fits on the rest of the row gets decoded straight into it
+        Cell *cells = row(pos.first + yoffset) + x;
+        unsigned short room = DimX - x, length = 0;
+        while (length < room && in < end) {
+#if defined(__SSE2__) && __WCHAR_MAX__ > 0xFFFF
+            // Every byte of a 16 byte block before the first one with its high bit set is ASCII, so those are widened and paired with the style 2 cells at a time
+            if (room - length >= 16 && end - in >= 16) {
+                __m128i bytes = _mm_loadu_si128((const __m128i *)in);
+                unsigned int mask = _mm_movemask_epi8(bytes);
+                // An odd prefix writes one cell too many, but that's the cell the multibyte character right after it is decoded into
+                unsigned char ascii = mask == 0 ? 16 : __builtin_ctz(mask), stores = (ascii + 1) / 2;
+
+                __m128i zero = _mm_setzero_si128(), styles = _mm_set1_epi32(style);
+                __m128i halves[2] = {_mm_unpacklo_epi8(bytes, zero), _mm_unpackhi_epi8(bytes, zero)};
+                __m128i *out = (__m128i *)(cells + length);
+
+                for (unsigned char h = 0; h < 2; h++) {
+                    __m128i chars[2] = {_mm_unpacklo_epi16(halves[h], zero), _mm_unpackhi_epi16(halves[h], zero)};
+                    for (unsigned char q = 0; q < 2; q++) {
+                        unsigned char p = h * 4 + q * 2;
+                        if (mask == 0 || p < stores) {_mm_storeu_si128(out + p, _mm_unpacklo_epi32(chars[q], styles));}
+                        if (mask == 0 || p + 1 < stores) {_mm_storeu_si128(out + p + 1, _mm_unpackhi_epi32(chars[q], styles));}
+                    }
+                }
+
+                in += ascii;
+                length += ascii;
+                // Otherwise only the multibyte character gets decoded on its own, and the next block starts right after it
+                if (mask == 0) {continue;}
+            }
+#endif
+            cells[length].Char = *in < 0x80 ? *in++ : decodeUtf8(in, end);
+            cells[length++].Style = style;
+        }
+        damage(pos.first + yoffset, x, length);
+
+        i += length;
+        x += length;
+    }
 
-    // Add leading zeros; negative numbers are accounted for by keeping the negative sign in front
-    for (int i = 0; i < minWidth - length; i++) {
-        num.insert(((input < 0) ? num.begin() + 1 : num.begin()), 1, '0');
+    // Whatever didn't fit still counts towards the returned position, just like with wide strings
+    while (in < end) {
+        decodeUtf8(in, end);
+        i++;
     }
 
-    return wstrp({pos.first, pos.second}, num, color, att, offset, wrap);
+    return {pos.first + yoffset + offset.first, pos.second + i - 1 - xoffset + offset.second};
 }
-std::pair<unsigned short, unsigned short> npp::Window::wintp(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wintp({y, x}, input, minWidth, color, att, offset, wrap);}
-unsigned short npp::Window::winty(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wintp(pos, input, minWidth, color, att, offset, wrap).first;}
-unsigned short npp::Window::winty(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return winty({y, x}, input, minWidth, color, att, offset, wrap);}
-unsigned short npp::Window::wintx(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wintp(pos, input, minWidth, color, att, offset, wrap).second;}
-unsigned short npp::Window::wintx(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wintx({y, x}, input, minWidth, color, att, offset, wrap);}
-void npp::Window::wint(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap) {wintp(pos, input, minWidth, color, att, {0, 0}, wrap);}
-void npp::Window::wint(unsigned short y, unsigned short x, int input, unsigned short minWidth = Defaults.MinWidth, unsigned char color = Defaults.Color, std::string att = Defaults.Attributes, bool wrap = Defaults.Wrap) {wint({y, x}, input, minWidth, color, att, wrap);}
 
-std::pair<unsigned short, unsigned short> npp::Window::wmstrp(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrcore(pos, input, mpalette.intern(color, att.Attr), offset, wrap);}
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp({y, x}, input, color, att, offset, wrap);}
+unsigned short npp::Window::wstry(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp(pos, input, color, att, offset, wrap).first;}
+unsigned short npp::Window::wstry(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstry({y, x}, input, color, att, offset, wrap);}
+unsigned short npp::Window::wstrx(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp(pos, input, color, att, offset, wrap).second;}
+unsigned short npp::Window::wstrx(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrx({y, x}, input, color, att, offset, wrap);}
+void npp::Window::wstr(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned char color, TextStyle att, bool wrap) {wstrp(pos, input, color, att, {0, 0}, wrap);}
+void npp::Window::wstr(unsigned short y, unsigned short x, std::wstring_view input, unsigned char color, TextStyle att, bool wrap) {wstr({y, x}, input, color, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrcore(pos, input, mpalette.intern(Defaults.Color, att.Attr, fg, bg), offset, wrap);}
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(unsigned short y, unsigned short x, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp({y, x}, input, fg, bg, att, offset, wrap);}
+void npp::Window::wstr(std::pair<unsigned short, unsigned short> pos, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att, bool wrap) {wstrp(pos, input, fg, bg, att, {0, 0}, wrap);}
+void npp::Window::wstr(unsigned short y, unsigned short x, std::wstring_view input, unsigned int fg, unsigned int bg, TextStyle att, bool wrap) {wstr({y, x}, input, fg, bg, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrcore(pos, input, mpalette.intern(color, att.Attr), offset, wrap);}
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(unsigned short y, unsigned short x, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp({y, x}, input, color, att, offset, wrap);}
+unsigned short npp::Window::wstry(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp(pos, input, color, att, offset, wrap).first;}
+unsigned short npp::Window::wstry(unsigned short y, unsigned short x, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstry({y, x}, input, color, att, offset, wrap);}
+unsigned short npp::Window::wstrx(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp(pos, input, color, att, offset, wrap).second;}
+unsigned short npp::Window::wstrx(unsigned short y, unsigned short x, std::string_view input, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrx({y, x}, input, color, att, offset, wrap);}
+void npp::Window::wstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, TextStyle att, bool wrap) {wstrp(pos, input, color, att, {0, 0}, wrap);}
+void npp::Window::wstr(unsigned short y, unsigned short x, std::string_view input, unsigned char color, TextStyle att, bool wrap) {wstr({y, x}, input, color, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrcore(pos, input, mpalette.intern(Defaults.Color, att.Attr, fg, bg), offset, wrap);}
+std::pair<unsigned short, unsigned short> npp::Window::wstrp(unsigned short y, unsigned short x, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wstrp({y, x}, input, fg, bg, att, offset, wrap);}
+void npp::Window::wstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att, bool wrap) {wstrp(pos, input, fg, bg, att, {0, 0}, wrap);}
+void npp::Window::wstr(unsigned short y, unsigned short x, std::string_view input, unsigned int fg, unsigned int bg, TextStyle att, bool wrap) {wstr({y, x}, input, fg, bg, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wintp(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {
     if (!checkCoord(pos)) {return pos;}
-    kerning = kerning < 1 ? 1 : kerning;
-    leading = leading < 1 ? 1 : leading;
 
+    // Leading zeros are added straight into the buffer; negative numbers are accounted for by keeping the negative sign in front
+    wchar_t num[NUM_BUFFER];
+    NumFormat format;
+    format.MinWidth = minWidth;
+
+    return wstrcore(pos, std::wstring_view(num, formatInt(num, input, format)), mpalette.intern(color, att.Attr), offset, wrap);
+}
+std::pair<unsigned short, unsigned short> npp::Window::wintp(unsigned short y, unsigned short x, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wintp({y, x}, input, minWidth, color, att, offset, wrap);}
+unsigned short npp::Window::winty(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wintp(pos, input, minWidth, color, att, offset, wrap).first;}
+unsigned short npp::Window::winty(unsigned short y, unsigned short x, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return winty({y, x}, input, minWidth, color, att, offset, wrap);}
+unsigned short npp::Window::wintx(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wintp(pos, input, minWidth, color, att, offset, wrap).second;}
+unsigned short npp::Window::wintx(unsigned short y, unsigned short x, int input, unsigned short minWidth, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wintx({y, x}, input, minWidth, color, att, offset, wrap);}
+void npp::Window::wint(std::pair<unsigned short, unsigned short> pos, int input, unsigned short minWidth, unsigned char color, TextStyle att, bool wrap) {wintp(pos, input, minWidth, color, att, {0, 0}, wrap);}
+void npp::Window::wint(unsigned short y, unsigned short x, int input, unsigned short minWidth, unsigned char color, TextStyle att, bool wrap) {wint({y, x}, input, minWidth, color, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wlongp(std::pair<unsigned short, unsigned short> pos, long long input, NumFormat format, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {
+    if (!checkCoord(pos)) {return pos;}
+
+    wchar_t num[NUM_BUFFER];
+    return wstrcore(pos, std::wstring_view(num, formatInt(num, input, format)), mpalette.intern(color, att.Attr), offset, wrap);
+}
+std::pair<unsigned short, unsigned short> npp::Window::wlongp(unsigned short y, unsigned short x, long long input, NumFormat format, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wlongp({y, x}, input, format, color, att, offset, wrap);}
+void npp::Window::wlong(std::pair<unsigned short, unsigned short> pos, long long input, NumFormat format, unsigned char color, TextStyle att, bool wrap) {wlongp(pos, input, format, color, att, {0, 0}, wrap);}
+void npp::Window::wlong(unsigned short y, unsigned short x, long long input, NumFormat format, unsigned char color, TextStyle att, bool wrap) {wlong({y, x}, input, format, color, att, wrap);}
+
+std::pair<unsigned short, unsigned short> npp::Window::wfloatp(std::pair<unsigned short, unsigned short> pos, double input, NumFormat format, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {
+    if (!checkCoord(pos)) {return pos;}
+
+    wchar_t num[NUM_BUFFER];
+    return wstrcore(pos, std::wstring_view(num, formatFloat(num, input, format)), mpalette.intern(color, att.Attr), offset, wrap);
+}
+std::pair<unsigned short, unsigned short> npp::Window::wfloatp(unsigned short y, unsigned short x, double input, NumFormat format, unsigned char color, TextStyle att, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wfloatp({y, x}, input, format, color, att, offset, wrap);}
+void npp::Window::wfloat(std::pair<unsigned short, unsigned short> pos, double input, NumFormat format, unsigned char color, TextStyle att, bool wrap) {wfloatp(pos, input, format, color, att, {0, 0}, wrap);}
+void npp::Window::wfloat(unsigned short y, unsigned short x, double input, NumFormat format, unsigned char color, TextStyle att, bool wrap) {wfloat({y, x}, input, format, color, att, wrap);}
+
+void npp::Window::writeField(NumField &field, const wchar_t *text, unsigned short length) {
+    // Characters that are the same as last time are left alone, and whatever is left of a longer old value gets blanked out
+    for (unsigned short i = 0; i < std::max(length, field.Length); i++) {
+        wchar_t ch = i < length ? text[i] : L' ';
+        if (i < field.Length && field.Text[i] == ch) {continue;}
+        if (!checkCoord(field.Y, field.X + i)) {break;}
+
+        putCell(field.Y, field.X + i, ch, field.Style);
+    }
+
+    std::copy(text, text + length, field.Text);
+    field.Length = length;
+}
+
+unsigned short npp::Window::addField(unsigned short y, unsigned short x, NumFormat format, unsigned char color, TextStyle att) {
+    // Removed fields get reused before the list grows
+    unsigned short id = 0;
+    while (id < Fields.size() && Fields[id].Active) {id++;}
+    if (id == Fields.size()) {Fields.emplace_back();}
+
+    NumField &field = Fields[id];
+    field.Y = y;
+    field.X = x;
+    field.Format = format;
+    field.Style = mpalette.intern(color, att.Attr);
+    field.Length = 0;
+    field.Active = true;
+
+    return id;
+}
+
+void npp::Window::ufield(unsigned short id, long long input) {
+    if (id >= Fields.size() || !Fields[id].Active) {return;}
+
+    wchar_t num[NUM_BUFFER];
+    writeField(Fields[id], num, formatInt(num, input, Fields[id].Format));
+}
+
+void npp::Window::ufieldf(unsigned short id, double input) {
+    if (id >= Fields.size() || !Fields[id].Active) {return;}
+
+    wchar_t num[NUM_BUFFER];
+    writeField(Fields[id], num, formatFloat(num, input, Fields[id].Format));
+}
+
+bool npp::Window::removeField(unsigned short id) {
+    if (id >= Fields.size() || !Fields[id].Active) {return false;}
+
+    Fields[id].Active = false;
+    return true;
+}
+
+void npp::Window::layoutText(TextBlock &block, std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned int style, bool danglingLetters, unsigned char kerning, unsigned char leading, bool wrap) {
     unsigned short posy = pos.first, posx = 0, xoffset = 0;
-    bool dangling = false;
 
     for (unsigned short i = 0; i < input.length(); i++) {
         // Automatically wrap the string back to the starting x-pos
@@ -360,54 +725,132 @@ std::pair<unsigned short, unsigned short> npp::Window::wmstrp(std::pair<unsigned
         // Quit early if the string goes out of bounds
         if (!checkCoord(posy + 2, posx + 2)) {break;}
 
-        for (unsigned char j = 0; j < Keys.MatrixText6x6.size(); j++) {
-            if (input[i] == Keys.MatrixText6x6[j].first) {
-                if (input[i] == 'g' || input[i] == 'j' || input[i] == 'p' || input[i] == 'q' || input[i] == 'y') {dangling = true;}
-
-                for (unsigned char k = 0; k < 3; k++) {
-                    for (unsigned char l = 0; l < 3; l++) {
-                        wchar(posy + k + (dangling ? 1 : 0), posx + l, Keys.MatrixText6x6[j].second[k][l], color);
-                    }
-                }
+        const MatrixGlyph &glyph = mmatrix.gglyph(input[i]);
+        if (!(glyph.Flags & GLYPH_DEFINED)) {continue;}
 
-                // Lowercase j needs a bit of extra work to fit in with the other lowercase letters since it has its dot
-                if (input[i] == 'j') {wchar(wcharp(posy, posx + 1, L'▝', color, "", {1, 0}), L'▐', color);}
+        // Each row of the glyph becomes its own run
+        unsigned short top = posy + ((glyph.Flags & GLYPH_DESCENDER) ? 1 : 0);
+        for (unsigned char k = 0; k < 3 && top + k < DimY; k++) {
+            block.Spans.push_back({(unsigned short)(top + k), posx, 3, (unsigned int)block.Cells.size()});
+            for (unsigned char l = 0; l < 3; l++) {block.Cells.push_back({glyph.Cells[k][l], style});}
+        }
 
-                dangling = false;
-                break;
-            }
+        // Lowercase j needs a bit of extra work to fit in with the other lowercase letters since it has its dot
+        if (glyph.Flags & GLYPH_DOT) {
+            block.Spans.push_back({posy, (unsigned short)(posx + 1), 1, (unsigned int)block.Cells.size()});
+            block.Cells.push_back({L'▝', style});
+            block.Spans.push_back({(unsigned short)(posy + 1), (unsigned short)(posx + 1), 1, (unsigned int)block.Cells.size()});
+            block.Cells.push_back({L'▐', style});
         }
     }
 
-    return {posy + 2 + offset.first, posx + 2 + offset.second};
+    block.End = {posy + 2, posx + 2};
+}
+
+void npp::Window::trimText(unsigned short size) {
+    // Throw out the least recently used blocks until the cache fits (it's small enough that a scan beats keeping a list in order)
+    while (TextCache.size() > size) {
+        auto oldest = TextCache.begin();
+        for (auto it = TextCache.begin(); it != TextCache.end(); it++) {oldest = (it->second.Used < oldest->second.Used) ? it : oldest;}
+        TextCache.erase(oldest);
+    }
+}
+
+void npp::Window::blitText(const TextBlock &block) {
+    for (const TextSpan &span : block.Spans) {
+        std::copy(block.Cells.begin() + span.Offset, block.Cells.begin() + span.Offset + span.Length, row(span.Y) + span.X);
+        damage(span.Y, span.X, span.Length);
+    }
+}
+
+std::pair<unsigned short, unsigned short> npp::Window::wmstrp(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {
+    if (!checkCoord(pos)) {return pos;}
+    kerning = kerning < 1 ? 1 : kerning;
+    leading = leading < 1 ? 1 : leading;
+
+    unsigned int style = mpalette.intern(color, Defaults.Attributes.Attr);
+
+    // Without the cache the string is laid out into a throwaway block
+    if (TextCacheSize == 0) {
+        TextBlock block;
+        layoutText(block, pos, input, style, danglingLetters, kerning, leading, wrap);
+        blitText(block);
+        return {block.End.first + offset.first, block.End.second + offset.second};
+    }
+
+    // Everything that changes the cells goes into the key (the style ID stands in for the color and attributes, and the string is last so that it can't run into the rest),
+    // which is built in a buffer that's kept around so that drawing a cached string doesn't allocate
+    TextKey.clear();
+    TextKey.append((const char *)&style, sizeof(style));
+    TextKey += (char)((danglingLetters ? 1 : 0) | (wrap ? 2 : 0));
+    TextKey += (char)kerning;
+    TextKey += (char)leading;
+    TextKey += (char)(pos.first >> 8);
+    TextKey += (char)pos.first;
+    TextKey += (char)(pos.second >> 8);
+    TextKey += (char)pos.second;
+    TextKey.append(input.data(), input.length());
+
+    auto found = TextCache.find(TextKey);
+    if (found != TextCache.end()) {
+        TextStats.Hits++;
+    } else {
+        TextStats.Misses++;
+
+        // Make room by throwing out the least recently used block
+        trimText(TextCacheSize - 1);
+
+        found = TextCache.emplace(TextKey, TextBlock()).first;
+        layoutText(found->second, pos, input, style, danglingLetters, kerning, leading, wrap);
+    }
+
+    found->second.Used = ++TextTick;
+    blitText(found->second);
+
+    return {found->second.End.first + offset.first, found->second.End.second + offset.second};
 }
-std::pair<unsigned short, unsigned short> npp::Window::wmstrp(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wmstrp({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
-unsigned short npp::Window::wmstry(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wmstrp(pos, input, color, danglingLetters, kerning, leading, offset, wrap).first;}
-unsigned short npp::Window::wmstry(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wmstry({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
-unsigned short npp::Window::wmstrx(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wmstrp(pos, input, color, danglingLetters, kerning, leading, offset, wrap).second;}
-unsigned short npp::Window::wmstrx(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, std::pair<unsigned short, unsigned short> offset = Defaults.Offset, bool wrap = Defaults.Wrap) {return wmstry({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
-void npp::Window::wmstr(std::pair<unsigned short, unsigned short> pos, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap) {wmstrp(pos, input, color, danglingLetters, kerning, leading, {0, 0}, wrap);}
-void npp::Window::wmstr(unsigned short y, unsigned short x, std::string input, unsigned char color = Defaults.Color, bool danglingLetters = Defaults.DanglingLetters, unsigned char kerning = Defaults.Kerning, unsigned char leading = Defaults.Leading, bool wrap = Defaults.Wrap) {wmstr({y, x}, input, color, danglingLetters, kerning, leading, wrap);}
+std::pair<unsigned short, unsigned short> npp::Window::wmstrp(unsigned short y, unsigned short x, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wmstrp({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
+unsigned short npp::Window::wmstry(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wmstrp(pos, input, color, danglingLetters, kerning, leading, offset, wrap).first;}
+unsigned short npp::Window::wmstry(unsigned short y, unsigned short x, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wmstry({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
+unsigned short npp::Window::wmstrx(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wmstrp(pos, input, color, danglingLetters, kerning, leading, offset, wrap).second;}
+unsigned short npp::Window::wmstrx(unsigned short y, unsigned short x, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, std::pair<unsigned short, unsigned short> offset, bool wrap) {return wmstry({y, x}, input, color, danglingLetters, kerning, leading, offset, wrap);}
+void npp::Window::wmstr(std::pair<unsigned short, unsigned short> pos, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, bool wrap) {wmstrp(pos, input, color, danglingLetters, kerning, leading, {0, 0}, wrap);}
+void npp::Window::wmstr(unsigned short y, unsigned short x, std::string_view input, unsigned char color, bool danglingLetters, unsigned char kerning, unsigned char leading, bool wrap) {wmstr({y, x}, input, color, danglingLetters, kerning, leading, wrap);}
 
 //
 // GET USER INPUT
 //
 
-int npp::Window::gchar(bool pause = true, bool enableKeypad = true, bool autoRender = true) {
+int npp::Window::gchar(bool pause, bool enableKeypad, bool autoRender) {
     if (autoRender) {rinst();}
+    if (mterm.gbackend() == BACKEND_HEADLESS) {return ERR;}
+
+    // Keys already come decoded from the input thread while it's running (and it's the only thing allowed to read stdin)
+    if (minput.grunning()) {
+        Event event;
+        if (!minput.gevent(event, pause ? -1 : 0)) {return ERR;}
+
+        mmouse.gmouse(event);
+        return event.Key;
+    }
 
     if (enableKeypad) {keypad(Win, true);}
     else {keypad(Win, false);}
     if (pause) {nodelay(Win, false);}
     else {nodelay(Win, true);}
 
-    return wgetch(Win);
+    int input = wgetch(Win);
+    if (input == KEY_MOUSE) {mmouse.usource(Win);}
+    return input;
 }
 
-std::wstring npp::Window::gstr(unsigned short y, unsigned short x, int maxChars = 255, unsigned char echoColor = Defaults.Color, std::string echoAtt = Defaults.Attributes, bool autoWrite = true, bool showStr = true, bool showCursor = true, bool enableKeypad = true) {
+std::wstring npp::Window::gstr(unsigned short y, unsigned short x, int maxChars, unsigned char echoColor, TextStyle echoAtt, bool autoWrite, bool showStr, bool showCursor, bool enableKeypad) {
     wint_t input[maxChars];
     std::wstring output;
 
+    // ncurses would be reading stdin at the same time as the input thread, with each of them getting half of the keys
+    if (mterm.gbackend() == BACKEND_HEADLESS || minput.grunning()) {return output;}
+
     if (enableKeypad) {keypad(Win, true);}
     if (showStr) {echo();}
     if (showCursor) {curs_set(1);}
@@ -439,138 +882,251 @@ std::wstring npp::Window::gstr(unsigned short y, unsigned short x, int maxChars
 //
 
 void npp::Window::rinst() {
-    for (unsigned short i = 0; i < DimY; i++) {
-        for (unsigned short j = 0; j < DimX; j++) {
-            write(i, j);
-        }
-    }
-    wrefresh(Win);
+    Stats = FrameStats();
+    flushDamage();
+    present();
 }
 
-void npp::Window::rline(unsigned char dir = 0, bool full = true, bool rev = false, unsigned long millis = 20) {
-    if (dir < 0 || dir > 3) {return rinst();}
+void npp::Window::stage() {
+    // Native and headless output already sits in the terminal's buffer until the next flush
+    if (mterm.gbackend() == BACKEND_NCURSES) {wnoutrefresh(Win);}
+}
 
-    unsigned short l1 = dir < 2 ? DimY : DimX;
-    unsigned short l2 = dir < 2 ? DimX : DimY;
-    
-    for (unsigned short i = 0; i < l1; i++) {
-        for (unsigned short j = 0; j < l2; j++) {
-            switch (dir) {
-                case 0:
-                    write(i, rev ? DimX - 1 - j : j);
+void npp::Window::ustats() {
+    // Only the native and headless backends count what they write
+    if (mterm.gbackend() == BACKEND_NCURSES) {return;}
+    Stats.Bytes += mterm.gbytes();
+    Stats.Syscalls += mterm.gsyscalls();
+}
+
+void npp::Window::rline(unsigned char dir, bool full, bool rev, unsigned long millis) {
+    Stats = FrameStats();
+    manim.add(aline(dir, full, rev, millis));
+    manim.run();
+}
+void npp::Window::rlinetop(bool full, bool rev, unsigned long millis) {rline(0, full, rev, millis);}
+void npp::Window::rlinebot(bool full, bool rev, unsigned long millis) {rline(1, full, rev, millis);}
+void npp::Window::rlineleft(bool full, bool rev, unsigned long millis) {rline(2, full, rev, millis);}
+void npp::Window::rlineright(bool full, bool rev, unsigned long millis) {rline(3, full, rev, millis);}
+
+void npp::Window::rrad(unsigned char divisions, double angle, bool ccw, unsigned long millis, double resolution) {
+    Stats = FrameStats();
+    manim.add(arad(divisions, angle, ccw, millis, resolution));
+    manim.run();
+}
+
+void npp::Window::rtrans(unsigned char effect, unsigned long millis, unsigned char curve, bool rev, unsigned char param) {
+    Stats = FrameStats();
+    manim.add(atrans(effect, millis, curve, rev, param));
+    manim.run();
+}
+
+std::shared_ptr<const std::vector<npp::Window::OrderCell>> npp::Window::getOrder(unsigned char effect, unsigned char param) {
+    // Only some transitions use the param, so the rest share a single ordering
+    if (effect == TRANSITION_CELLS_BY_ROW || effect == TRANSITION_CELLS_BY_COL) {param = param ? 1 : 0;}
+    else if (effect == TRANSITION_RADIAL) {param = param < 1 ? 1 : param;}
+    else {param = 0;}
+
+    unsigned short id = effect << 8 | param;
+    auto found = Orders.find(id);
+    if (found != Orders.end()) {return found->second;}
+
+    unsigned int total = DimY * DimX;
+    std::shared_ptr<std::vector<OrderCell>> order = std::make_shared<std::vector<OrderCell>>();
+    order->reserve(total);
+
+    // A random (but repeatable) rank for every cell
+    std::vector<unsigned int> shuffled;
+    if (effect == TRANSITION_DISSOLVE) {
+        shuffled.resize(total);
+        for (unsigned int i = 0; i < total; i++) {shuffled[i] = i;}
+        std::minstd_rand rng(total);
+        for (unsigned int i = total; i > 1; i--) {std::swap(shuffled[i - 1], shuffled[rng() % i]);}
+    }
+
+    for (unsigned short y = 0; y < DimY; y++) {
+        for (unsigned short x = 0; x < DimX; x++) {
+            double key = 0;
+
+            switch (effect) {
+                case TRANSITION_ROWS:
+                    key = (double)y / DimY;
+                    break;
+                case TRANSITION_COLS:
+                    key = (double)x / DimX;
+                    break;
+                case TRANSITION_CELLS_BY_ROW:
+                    key = (double)(y * DimX + (param ? DimX - 1 - x : x)) / total;
+                    break;
+                case TRANSITION_CELLS_BY_COL:
+                    key = (double)(x * DimY + (param ? DimY - 1 - y : y)) / total;
                     break;
-                case 1:
-                    write(DimY - 1 - i, rev ? DimX - 1 - j : j);
+                case TRANSITION_RADIAL: {
+                    // Rows are stretched so that the sweep looks right with cells being taller than they are wide
+                    double divAngle = 2 * M_PI / param;
+                    double angle = atan2(-4.0 * (y - DimY / 2), (double)(x - DimX / 2));
+                    angle = angle < 0 ? angle + 2 * M_PI : angle;
+                    key = std::fmod(angle, divAngle) / divAngle;
                     break;
-                case 2:
-                    write(rev ? DimY - 1 - j : j, i);
+                }
+                case TRANSITION_SPIRAL: {
+                    // Each ring goes clockwise from its top-left corner, after every cell of the rings around it
+                    unsigned short ring = std::min(std::min(y, x), std::min((unsigned short)(DimY - 1 - y), (unsigned short)(DimX - 1 - x)));
+                    unsigned int ringY = DimY - 2 * ring;
+                    unsigned int ringX = DimX - 2 * ring;
+                    unsigned int rank = total - ringY * ringX;
+
+                    if (y == ring) {rank += x - ring;}
+                    else if (x == DimX - 1 - ring) {rank += ringX - 1 + y - ring;}
+                    else if (y == DimY - 1 - ring) {rank += ringX - 1 + ringY - 1 + DimX - 1 - ring - x;}
+                    else {rank += 2 * (ringX - 1) + ringY - 1 + DimY - 1 - ring - y;}
+
+                    key = (double)rank / total;
+                    break;
+                }
+                case TRANSITION_DISSOLVE:
+                    key = (double)shuffled[y * DimX + x] / total;
                     break;
-                case 3:
-                    write(rev ? DimY - 1 - j : j, DimX - 1 -i);
+                case TRANSITION_DIAGONAL:
+                    // Rows count double since cells are about twice as tall as they are wide
+                    key = (double)(2 * y + x) / (2 * (DimY - 1) + DimX);
                     break;
             }
 
-            if (!full) {
-                wrefresh(Win);
-                if (wait(millis)) {return rinst();}
-            }
+            order->push_back({(float)key, (unsigned int)(y * DimX + x)});
         }
-        
-        wrefresh(Win);
-        if (wait(millis)) {return rinst();}
     }
+
+    std::stable_sort(order->begin(), order->end(), [](const OrderCell &a, const OrderCell &b) {return a.Key < b.Key;});
+
+    return Orders[id] = order;
+}
+
+npp::Animation npp::Window::aorder(std::shared_ptr<const std::vector<OrderCell>> order, unsigned long millis, unsigned char curve, bool rev, double offset) {
+    Animation anim;
+    anim.Win = this;
+
+    // Whatever didn't get written is taken care of at the end
+    anim.Finish = [this]() {
+        damageAll();
+        flushDamage();
+    };
+
+    unsigned int total = order->size();
+    if (total == 0) {return anim;}
+
+    // A step per frame, though never more steps than there are cells
+    anim.Steps = (millis + FRAME_MILLIS - 1) / FRAME_MILLIS;
+    anim.Steps = anim.Steps < 1 ? 1 : (anim.Steps > total ? total : anim.Steps);
+    anim.Millis = millis;
+
+    // Going around the sorted cells from the offset (backwards if reversed) visits them in the order that they get revealed
+    std::shared_ptr<std::vector<unsigned int>> cells = std::make_shared<std::vector<unsigned int>>();
+    std::shared_ptr<std::vector<unsigned int>> ends = std::make_shared<std::vector<unsigned int>>(anim.Steps, total);
+    unsigned int first = std::lower_bound(order->begin(), order->end(), offset, [](const OrderCell &cell, double value) {return cell.Key < value;}) - order->begin();
+
+    cells->reserve(total);
+    std::vector<double> phases;
+    phases.reserve(total);
+    for (unsigned int i = 0; i < total; i++) {
+        const OrderCell &cell = (*order)[rev ? (first + total - 1 - i) % total : (first + i) % total];
+        double phase = rev ? offset - cell.Key : cell.Key - offset;
+        phase = rev ? (phase <= 0 ? phase + 1 : phase) : (phase < 0 ? phase + 1 : phase);
+
+        cells->push_back(cell.Index);
+        phases.push_back(phase);
+    }
+
+    // Each step reveals the cells that the curve passes over during it (the last step reveals everything that's left)
+    unsigned int revealed = 0;
+    for (unsigned long step = 0; step + 1 < anim.Steps; step++) {
+        double t = (double)(step + 1) / anim.Steps;
+
+        switch (curve) {
+            case CURVE_EASE_IN:
+                t = t * t;
+                break;
+            case CURVE_EASE_OUT:
+                t = 1 - (1 - t) * (1 - t);
+                break;
+            case CURVE_EASE_IN_OUT:
+                t = t * t * (3 - 2 * t);
+                break;
+        }
+
+        while (revealed < total && (rev ? phases[revealed] <= t : phases[revealed] < t)) {revealed++;}
+        (*ends)[step] = revealed;
+    }
+
+    anim.Step = [this, cells, ends](unsigned long step) {
+        unsigned int end = (*ends)[step];
+
+        // Neighboring cells in the same row are written as a single span
+        for (unsigned int i = step == 0 ? 0 : (*ends)[step - 1]; i < end;) {
+            unsigned int lo = (*cells)[i];
+            unsigned int hi = lo;
+
+            for (i++; i < end; i++) {
+                unsigned int next = (*cells)[i];
+                if (next == hi + 1 && next / DimX == lo / DimX) {hi = next;}
+                else if (next + 1 == lo && next / DimX == hi / DimX) {lo = next;}
+                else {break;}
+            }
+
+            write(lo / DimX, lo % DimX, hi - lo + 1);
+        }
+    };
+
+    return anim;
+}
+
+npp::Animation npp::Window::atrans(unsigned char effect, unsigned long millis, unsigned char curve, bool rev, unsigned char param) {
+    return aorder(getOrder(effect, param), millis, curve, rev, 0);
+}
+
+npp::Animation npp::Window::aline(unsigned char dir, bool full, bool rev, unsigned long millis) {
+    // Invalid directions just get written at the end
+    if (dir < 0 || dir > 3) {return aorder(std::make_shared<const std::vector<OrderCell>>(), 0, CURVE_LINEAR, false, 0);}
+
+    // Full lines took a step each, otherwise every character did
+    unsigned long steps = (dir < 2 ? DimY : DimX) * (full ? 1 : (dir < 2 ? DimX : DimY));
+    bool backwards = dir == 1 || dir == 3;
+
+    // Going up or left walks the opposite ordering backwards, which flips the direction within each line too
+    if (full) {return aorder(getOrder(dir < 2 ? TRANSITION_ROWS : TRANSITION_COLS, 0), steps * millis, CURVE_LINEAR, backwards, 0);}
+    return aorder(getOrder(dir < 2 ? TRANSITION_CELLS_BY_ROW : TRANSITION_CELLS_BY_COL, backwards ? !rev : rev), steps * millis, CURVE_LINEAR, backwards, 0);
 }
-void npp::Window::rlinetop(bool full = true, bool rev = false, unsigned long millis = 20) {rline(0, full, rev, millis);}
-void npp::Window::rlinebot(bool full = true, bool rev = false, unsigned long millis = 20) {rline(1, full, rev, millis);}
-void npp::Window::rlineleft(bool full = true, bool rev = false, unsigned long millis = 20) {rline(2, full, rev, millis);}
-void npp::Window::rlineright(bool full = true, bool rev = false, unsigned long millis = 20) {rline(3, full, rev, millis);}
 
-void npp::Window::rrad(unsigned char divisions = 2, double angle = 90, bool ccw = true, unsigned long millis = 5, double resolution = 0.005) {
+npp::Animation npp::Window::arad(unsigned char divisions, double angle, bool ccw, unsigned long millis, double resolution) {
     // Fix the angle input and then convert it to radians
     angle = angle < 0 && !ccw ? angle + 90 : angle;
     while (angle < 0) {angle += 360;}
-    angle = angle * (M_PI / 180);
+    angle = std::fmod(angle * (M_PI / 180), 2 * M_PI);
 
+    divisions = divisions < 1 ? 1 : divisions;
     double divAngle = 2 * M_PI / divisions;
-    double slope, cangle;
-    unsigned char resMult;
-
-    for (double i = angle; i < divAngle + angle; i += resolution) {
-        // Each division will need to draw its own line and stuff
-        for (unsigned char j = 0; j < divisions; j++) {
-            // Find the angle that will be used to find the current slope
-            cangle = i + divAngle * j;
-            while (cangle >= M_PI * 2) {cangle -= M_PI * 2;}
-
-            slope = (ccw ? -1 : 1) * ((DimX / 2) * sin(cangle)) / (DimX * cos(cangle));
-            resMult = (cangle < M_PI / 2 + resolution * 16 && cangle > M_PI / 2 - resolution * 16) || (cangle < 3 * M_PI / 2 + resolution * 16 && cangle > 3 * M_PI / 2 - resolution * 16) ? 10 : 25;
-
-            // Pretty much just draw a line from the middle of the window to the edge of the window along the calculated slope
-            for (double k = 0; k <= DimX / 2; k+= resolution * resMult) {
-                if (cangle < M_PI / 2 || cangle > 3 * M_PI / 2) {
-                    write(DimY / 2 + slope * k, DimX / 2 + k * 2);
-                    write(DimY / 2 + slope * k - 1, DimX / 2 + k * 2);
-                    write(DimY / 2 + slope * k + 1, DimX / 2 + k * 2);
-                    write(DimY / 2 + slope * k, DimX / 2 + k * 2 - 1);
-                    write(DimY / 2 + slope * k, DimX / 2 + k * 2 + 2);
-                } else {
-                    write(DimY / 2 - slope * k, DimX / 2 - k * 2);
-                    write(DimY / 2 - slope * k - 1, DimX / 2 - k * 2);
-                    write(DimY / 2 - slope * k + 1, DimX / 2 - k * 2);
-                    write(DimY / 2 - slope * k, DimX / 2 - k * 2 - 1);
-                    write(DimY / 2 - slope * k, DimX / 2 - k * 2 + 2);
-                }
-            }
-        }
-    
-        wrefresh(Win);
-        if (wait(millis)) {return rinst();}
-    }
 
-    rinst();
+    // The sweeper moves by resolution every millis, and starts at the angle (which is where it is in its division that matters)
+    double start = std::fmod(ccw ? angle : 2 * M_PI - angle, divAngle) / divAngle;
+    return aorder(getOrder(TRANSITION_RADIAL, divisions), std::ceil(divAngle / resolution) * millis, CURVE_LINEAR, !ccw, start);
 }
 
 //
 // LINE DRAWING
 //
 
-void npp::Window::dline(unsigned short y, unsigned short x, unsigned short length, bool vertical = false, bool rev = false, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {
+void npp::Window::dline(unsigned short y, unsigned short x, unsigned short length, bool vertical, bool rev, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {
     if (!checkCoord(y, x) || length <= 0 || (y < 0 && rev) || (y >= DimY && !rev) || (x < 0 && rev) || (x >= DimX && !rev)) {return;}
     style.first = (style.first < 0 || style.first >= 8) ? LIGHT_HARD : style.first;
     style.second = (style.second < 0 || style.second >= 6) ? DASHED_NONE : style.second;
 
     unsigned short posy = y, posx = x;
-    std::vector<unsigned char> dirs;
-    wchar_t piece;
+    unsigned char dirs[4];
     unsigned char tdir1 = vertical ? (DIR_DOWN - (rev ? 1 : 0)) : (DIR_RIGHT - (rev ? 1 : 0));
     unsigned char tdir2 = tdir1 + (rev ? 1 : -1);
 
     /// @brief Used to fabricate a direction (connection style) based on the inputted style
-    unsigned char cstyle;
-    switch (style.first) {
-        case LIGHT_HARD:
-        case LIGHT_SOFT:
-            cstyle = STYLE_LIGHT;
-            break;
-        case HEAVY_BOTH:
-            cstyle = STYLE_HEAVY;
-            break;
-        case HEAVY_HORIZONTAL:
-            cstyle = vertical ? STYLE_LIGHT : STYLE_HEAVY;
-            break;
-        case HEAVY_VERTICAL:
-            cstyle = vertical ? STYLE_HEAVY : STYLE_LIGHT;
-            break;
-        case DOUBLED_BOTH:
-            cstyle = STYLE_DOUBLED;
-            break;
-        case DOUBLED_HORIZTONAL:
-            cstyle = vertical ? STYLE_LIGHT : STYLE_DOUBLED;
-            break;
-        case DOUBLED_VERTICAL:
-            cstyle = vertical ? STYLE_DOUBLED : STYLE_LIGHT;
-            break;
-    }
+    unsigned char cstyle = getLineStyle(style.first, vertical);
 
     for (unsigned short i = 0; i < length; i++) {
         // Quit early if the line starts to venture out of the window
@@ -578,8 +1134,10 @@ void npp::Window::dline(unsigned short y, unsigned short x, unsigned short lengt
 
         // Get the directions (connection styles) of the surrounding characters (for connecting to existing lines)
         // This step is skipped if the line isn't suppsoed to merge with others
-        if (canMerge) {dirs = {getConnectStyle(posy - 1, posx, DIR_DOWN), getConnectStyle(posy + 1, posx, DIR_UP), getConnectStyle(posy, posx - 1, DIR_RIGHT), getConnectStyle(posy, posx + 1, DIR_LEFT)};}
-        else {dirs = {STYLE_NONE, STYLE_NONE, STYLE_NONE, STYLE_NONE};}
+        dirs[DIR_UP] = canMerge ? getConnectStyle(posy - 1, posx, DIR_DOWN) : STYLE_NONE;
+        dirs[DIR_DOWN] = canMerge ? getConnectStyle(posy + 1, posx, DIR_UP) : STYLE_NONE;
+        dirs[DIR_LEFT] = canMerge ? getConnectStyle(posy, posx - 1, DIR_RIGHT) : STYLE_NONE;
+        dirs[DIR_RIGHT] = canMerge ? getConnectStyle(posy, posx + 1, DIR_LEFT) : STYLE_NONE;
 
         // With the exception of the end pieces, the line has to have directions fabricated in order to actually exist
         if (i == 0) {dirs[tdir2] = (dirs[tdir2] == STYLE_NONE && dirs[vertical ? DIR_LEFT : DIR_UP] == STYLE_NONE && dirs[vertical ? DIR_RIGHT : DIR_DOWN] == STYLE_NONE) ? cstyle : dirs[tdir2];}
@@ -587,32 +1145,18 @@ void npp::Window::dline(unsigned short y, unsigned short x, unsigned short lengt
         if (i == length - 1) {dirs[tdir1] = (dirs[tdir1] == STYLE_NONE && dirs[vertical ? DIR_LEFT : DIR_UP] == STYLE_NONE && dirs[vertical ? DIR_RIGHT : DIR_DOWN] == STYLE_NONE) ? cstyle : dirs[tdir1];}
         else {dirs[tdir1] = cstyle;}
 
-        piece = getPiece(dirs, style);
-
-        // In the scenario that a doubled line intersects with a heavy one, the directions need to be altered because there are no
-        // unicode characters that properly mesh the two styles; the current style is kept because it is the most recent one being used
-        if (piece == L' ') {
-            // If the current style is heavy, then all doubled directions are replaced with heavy directions
-            // The opposite is done if the current style is doubled
-            for (unsigned char i = 0; i < 4; i++) {
-                if (style.first == HEAVY_BOTH || style.first == HEAVY_HORIZONTAL || style.first == HEAVY_VERTICAL) {dirs[i] = (dirs[i] == STYLE_DOUBLED) ? STYLE_HEAVY : dirs[i];}
-                else {dirs[i] = (dirs[i] == STYLE_HEAVY) ? STYLE_DOUBLED : dirs[i];}
-            }
-
-            piece = getPiece(dirs, style);
-        }
-
-        wchar(posy, posx, piece, color);
-        Grid[posy][posx].CanMerge = mergeable;
+        // Heavy lines meeting doubled ones are already taken care of by the table that getPiece() looks in
+        wchar(posy, posx, getPiece(dirs, style), color);
+        cellAt(posy, posx).Style = mpalette.umerge(cellAt(posy, posx).Style, mergeable);
 
         posy = y + (rev ? -1 : 1) * (i + 1) * (vertical ? 1 : 0);
         posx = x + (rev ? -1 : 1) * (i + 1) * (vertical ? 0 : 1);
     }
 }
-void npp::Window::dvline(unsigned short y, unsigned short x, unsigned short length, bool rev = false, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dline(y, x, length, true, rev, style, color, mergeable, canMerge);}
-void npp::Window::dhline(unsigned short y, unsigned short x, unsigned short length, bool rev = false, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dline(y, x, length, false, rev, style, color, mergeable, canMerge);}
+void npp::Window::dvline(unsigned short y, unsigned short x, unsigned short length, bool rev, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dline(y, x, length, true, rev, style, color, mergeable, canMerge);}
+void npp::Window::dhline(unsigned short y, unsigned short x, unsigned short length, bool rev, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dline(y, x, length, false, rev, style, color, mergeable, canMerge);}
 
-void npp::Window::dbox(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {                
+void npp::Window::dbox(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {                
     if (!checkCoord(y, x) || !checkCoord(y + dimy, x + dimx) || dimy < 1 || dimx < 1) {return;}
 
     // Special cases for when the dimensions of the box are 1
@@ -620,30 +1164,38 @@ void npp::Window::dbox(unsigned short y, unsigned short x, unsigned short dimy,
     else if (dimy == 1) {return dhline(y, x, dimx, false, style, color, mergeable, canMerge);}
     else if (dimx == 1) {return dvline(y, x, dimy, false, style, color, mergeable, canMerge);}
 
-    dvline(y, x, dimy, false, style, color, mergeable, canMerge);
-    dvline(y, x + dimx - 1, dimy, false, style, color, mergeable, canMerge);
-    dhline(y, x, dimx, false, style, color, mergeable, canMerge);
-    dhline(y + dimy - 1, x, dimx, false, style, color, mergeable, canMerge);
+    GridRows.assign(1, dimy - 2);
+    GridCols.assign(1, dimx - 2);
+    composeGrid(y, x, GridRows, GridCols, style, color, mergeable, canMerge);
 }
-void npp::Window::dbox(std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dbox(0, 0, DimY, DimX, style, color, false, false);}
-void npp::Window::dcbox(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dbox(y - dimy / 2, x - dimx / 2, dimy, dimx, style, color, mergeable, canMerge);}
+void npp::Window::dbox(std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dbox(0, 0, DimY, DimX, style, color, false, false);}
+void npp::Window::dcbox(unsigned short y, unsigned short x, unsigned short dimy, unsigned short dimx, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dbox(y - dimy / 2, x - dimx / 2, dimy, dimx, style, color, mergeable, canMerge);}
 
-void npp::Window::dgrid(unsigned short y, unsigned short x, unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = true) {
+void npp::Window::dgrid(unsigned short y, unsigned short x, unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {
     std::pair<unsigned short, unsigned short> dims = gGridDims(rows, cols, celly, cellx);
 
     if (!checkCoord(y, x) || !checkCoord(dims.first, dims.second) || rows < 1 || cols < 1 || celly < 0 || cellx < 0) {return;}
 
-    // Vertical lines
-    for (unsigned short i = 0; i <= cols; i++) {
-        dvline(y, x + cellx * i + i, dims.first, false, style, color, mergeable, canMerge);
-    }
-    // Horizontal lines
-    for (unsigned short i = 0; i <= rows; i++) {
-        dhline(y + celly * i + i, x, dims.second, false, style, color, mergeable, canMerge);
-    }
+    GridRows.assign(rows, celly);
+    GridCols.assign(cols, cellx);
+    composeGrid(y, x, GridRows, GridCols, style, color, mergeable, canMerge);
 }
-void npp::Window::dgrid(unsigned short y, unsigned short x, unsigned short cells, unsigned short cellDim, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dgrid(y, x, cells, cells, cellDim, cellDim * 2, style, color, mergeable, canMerge);}
-void npp::Window::dcgrid(unsigned short y, unsigned short x, unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dgrid(y - gGridDims(rows, cols, celly, cellx).first, x - gGridDims(rows, cols, celly, cellx).second, rows, cols, celly, cellx, style, color, mergeable, canMerge);}
-void npp::Window::dcgrid(unsigned short y, unsigned short x, unsigned short cells, unsigned short cellDim, std::pair<unsigned char, unsigned char> style = Defaults.Style, unsigned char color = Defaults.Color, bool mergeable = Defaults.Mergeable, bool canMerge = Defaults.CanMerge) {dcgrid(y, x, cells, cells, cellDim, cellDim * 2, style, color, mergeable, canMerge);}
+void npp::Window::dgrid(unsigned short y, unsigned short x, unsigned short cells, unsigned short cellDim, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dgrid(y, x, cells, cells, cellDim, cellDim * 2, style, color, mergeable, canMerge);}
+void npp::Window::dgrid(unsigned short y, unsigned short x, const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {
+    std::pair<unsigned short, unsigned short> dims = gGridDims(rowDims, colDims);
+
+    if (!checkCoord(y, x) || !checkCoord(dims.first, dims.second) || rowDims.empty() || colDims.empty()) {return;}
+
+    composeGrid(y, x, rowDims, colDims, style, color, mergeable, canMerge);
+}
+void npp::Window::dcgrid(unsigned short y, unsigned short x, unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dgrid(y - gGridDims(rows, cols, celly, cellx).first, x - gGridDims(rows, cols, celly, cellx).second, rows, cols, celly, cellx, style, color, mergeable, canMerge);}
+void npp::Window::dcgrid(unsigned short y, unsigned short x, unsigned short cells, unsigned short cellDim, std::pair<unsigned char, unsigned char> style, unsigned char color, bool mergeable, bool canMerge) {dcgrid(y, x, cells, cells, cellDim, cellDim * 2, style, color, mergeable, canMerge);}
 
 std::pair<unsigned short, unsigned short> npp::Window::gGridDims(unsigned short rows, unsigned short cols, unsigned short celly, unsigned short cellx) {return {rows * celly + (rows + 1), cols * cellx + (cols + 1)};}
+std::pair<unsigned short, unsigned short> npp::Window::gGridDims(const std::vector<unsigned short> &rowDims, const std::vector<unsigned short> &colDims) {
+    std::pair<unsigned short, unsigned short> dims = {rowDims.size() + 1, colDims.size() + 1};
+    for (unsigned short dim : rowDims) {dims.first += dim;}
+    for (unsigned short dim : colDims) {dims.second += dim;}
+
+    return dims;
+}
@@ -0,0 +1,44 @@
+#include "General.hpp"
+
+// Renders the same frame twice through the headless backend and checks that the second one doesn't allocate (needs NPP_DEBUG for gallocs())
+
+#ifdef NPP_DEBUG
+static void frame(npp::Window &win) {
+    win.reset();
+    win.dbox(0, 0, 10, 40);
+    win.dgrid(12, 2, 2, 3);
+    win.wstr(1, 2, L"Steady state");
+    win.wstr(2, 2, std::wstring_view(L"A wide string view"), npp::rgb(200, 100, 50), 0);
+    win.wchar(3, 2, L'█', 2);
+    win.wmstr(4, 2, "ab", 3);
+    win.rinst();
+}
+#endif
+
+int main() {
+#ifndef NPP_DEBUG
+    printf("Allocation tests skipped (build with -DNPP_DEBUG)\n");
+    return 0;
+#else
+    npp::initHeadless(24, 80);
+    npp::Window win(0, 0, 24, 80);
+
+    // The first frame sizes every buffer and cache
+    frame(win);
+    npp::mterm.clearCapture();
+
+    unsigned long before = npp::gallocs();
+    frame(win);
+    unsigned long after = npp::gallocs();
+
+    npp::end();
+    if (after != before) {
+        printf("FAIL: a warm frame made %lu allocations\n", after - before);
+        printf("Allocation tests failed\n");
+        return 1;
+    }
+
+    printf("Allocation tests passed\n");
+    return 0;
+#endif
+}
@@ -0,0 +1,69 @@
+#include "General.hpp"
+
+// Renders frames through the headless backend and checks what ended up on the simulated screen and in the captured bytes
+
+static int failures = 0;
+
+static void check(bool passed, const char *what) {
+    if (!passed) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+int main() {
+    npp::initHeadless(6, 20);
+    npp::Window win(1, 2, 4, 12);
+
+    // First frame - a box with text in it
+    win.dbox(0, 0, 3, 10);
+    win.wstr(1, 1, L"hello", 3, "bo");
+    win.rinst();
+
+    check(npp::mterm.grow(1) == L"  ┌────────┐        ", "top of the box");
+    check(npp::mterm.grow(2) == L"  │hello   │        ", "text inside the box");
+    check(npp::mterm.grow(3) == L"  └────────┘        ", "bottom of the box");
+    check(npp::mterm.grow(0) == std::wstring(20, L' ') && npp::mterm.grow(5) == std::wstring(20, L' '), "nothing outside the window");
+
+    npp::ScreenCell cell = npp::mterm.gcell(2, 3);
+    check(cell.Char == L'h' && (cell.Attr & ATTR_BOLD) && cell.Fg == 3, "style of the text");
+    check(npp::mterm.gcapture().find("hello") != std::string::npos, "text was written");
+    check(npp::mterm.gcapture().find("\033[2;3H") != std::string::npos, "cursor moved to the window");
+    check(win.gstats().Syscalls == 1, "a frame is a single write");
+
+    // Second frame - nothing changed, so nothing is sent
+    npp::mterm.clearCapture();
+    win.rinst();
+    check(npp::mterm.gcapture().empty(), "an unchanged frame writes nothing");
+    check(win.gstats().Cells == 0, "an unchanged frame writes no cells");
+
+    // Third frame - only the changed cells are sent
+    win.wstr(1, 1, L"help", 3, "bo");
+    win.rinst();
+    check(npp::mterm.grow(2) == L"  │helpo   │        ", "changed text is on the screen");
+    check(win.gstats().Cells == 1, "only the changed cell is written");
+    check(npp::mterm.gcapture().find("hel") == std::string::npos, "unchanged cells aren't written again");
+
+    // Animated frame - every tick's flush is counted by the window
+    win.wstr(1, 1, L"world", 3, "bo");
+    npp::mterm.clearCapture();
+    win.rrad();
+    check(npp::mterm.grow(2) == L"  │world   │        ", "animated text is on the screen");
+    check(win.gstats().Bytes == npp::mterm.gcapture().size(), "every byte of an animation is counted");
+    check(win.gstats().Syscalls > 0, "an animation's writes are counted");
+
+    // Changing 24-bit colors every frame - looks that no cell uses anymore are collected, while the ones still on the window keep their colors
+    win.reset();
+    win.wstr(0, 0, L"k", npp::rgb(1, 2, 3), 0);
+    for (unsigned int i = 0; i < 20000; i++) {
+        win.wstr(0, 1, L"c", npp::rgb(i >> 8, i & 0xFF, 7), 0);
+        win.rinst();
+    }
+    check(npp::mpalette.gcount() < 10000, "the palette stays bounded");
+    check(win.sfg(0, 0) == npp::rgb(1, 2, 3) && npp::mterm.gcell(1, 2).Fg == npp::rgb(1, 2, 3), "a look still in use is kept");
+    check(win.sfg(0, 1) == npp::rgb(19999 >> 8, 19999 & 0xFF, 7) && npp::mterm.gcell(1, 3).Fg == npp::rgb(19999 >> 8, 19999 & 0xFF, 7), "a reused look is drawn with its own colors");
+
+    npp::end();
+    printf("%s\n", failures ? "Headless tests failed" : "Headless tests passed");
+    return failures ? 1 : 0;
+}
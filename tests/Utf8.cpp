@@ -0,0 +1,121 @@
+#include "General.hpp"
+
+// Writes UTF-8 strings to a headless window and sends them through the input thread, checking the characters that were decoded (malformed input becomes U+FFFD, one per byte that couldn't be used)
+
+static int failures = 0;
+
+static void check(bool passed, const char *what) {
+    if (!passed) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+/// @brief Decoded - Write a UTF-8 string to the start of a blank row and read back what ended up in the cells
+/// @param win Window to write to
+/// @param input UTF-8 string to write
+/// @returns The characters of the row, up to the first blank left over from the reset
+static std::wstring decoded(npp::Window &win, std::string_view input) {
+    win.reset();
+    win.wstr(0, 0, input);
+
+    std::wstring output;
+    for (unsigned short x = 0; x < win.gdimx() && win.schar(0, x) != L' '; x++) {output += win.schar(0, x);}
+    return output;
+}
+
+/// @brief Typed - Send bytes through the input thread and collect the keys that come out
+/// @param fd Write end of the pipe that minput reads from
+/// @param input Bytes to send
+/// @returns The keys, in order, until none come for a bit
+static std::wstring typed(int fd, std::string_view input) {
+    if (::write(fd, input.data(), input.length()) < 0) {return L"";}
+
+    std::wstring output;
+    npp::Event event;
+    while (npp::minput.gevent(event, 200)) {output += (wchar_t)event.Key;}
+    return output;
+}
+
+int main() {
+    npp::initHeadless(4, 120);
+    npp::Window win(0, 0, 4, 120);
+
+    // Well formed characters of every length
+    check(decoded(win, "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z") == L"aé€😀z", "one to four byte characters");
+    check(decoded(win, "\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBD\xF0\x90\x80\x80\xF4\x8F\xBF\xBF") == L"\u0080߿ࠀ�\U00010000\U0010FFFF", "shortest and longest of each length");
+
+    // Overlong encodings
+    check(decoded(win, "a\xC0\xAF" "b") == L"a��b", "overlong two byte slash");
+    check(decoded(win, "a\xC1\xBF" "b") == L"a��b", "overlong two byte DEL");
+    check(decoded(win, "a\xE0\x80\xAF" "b") == L"a���b", "overlong three byte slash");
+    check(decoded(win, "a\xF0\x82\x82\xAC" "b") == L"a����b", "overlong four byte euro sign");
+
+    // Surrogates (only UTF-16 has any use for them)
+    check(decoded(win, "a\xED\xA0\x80" "b") == L"a���b", "high surrogate");
+    check(decoded(win, "a\xED\xBF\xBF" "b") == L"a���b", "low surrogate");
+
+    // Past U+10FFFF
+    check(decoded(win, "a\xF4\x90\x80\x80" "b") == L"a����b", "U+110000");
+    check(decoded(win, "a\xF5\x80\x80\x80" "b") == L"a����b", "lead byte past F4");
+    check(decoded(win, "a\xFF" "b") == L"a�b", "lead byte FF");
+
+    // Sequences that are cut short or missing their lead
+    check(decoded(win, "a\x80" "b") == L"a�b", "stray continuation byte");
+    check(decoded(win, "a\xE2\x82" "b") == L"a��b", "sequence interrupted by ASCII");
+    check(decoded(win, "ab\xF0\x9F\x98") == L"ab���", "sequence cut off by the end of the string");
+
+    // A non-ASCII character at every position around the 16 byte blocks that get widened at once, compared against writing the same string as a wide string
+    const char *multis[3] = {"\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80"};
+    const wchar_t *wides[3] = {L"é", L"€", L"😀"};
+    bool matched = true, samePos = true;
+    for (unsigned char m = 0; m < 3; m++) {
+        for (unsigned short length = 1; length <= 48; length++) {
+            for (unsigned short at = 0; at < length; at++) {
+                std::string narrow;
+                std::wstring wide;
+                for (unsigned short i = 0; i < length; i++) {
+                    if (i == at) {
+                        narrow += multis[m];
+                        wide += wides[m];
+                    } else {
+                        narrow += (char)('a' + i % 26);
+                        wide += (wchar_t)(L'a' + i % 26);
+                    }
+                }
+
+                if (decoded(win, narrow) != wide) {matched = false;}
+                if (win.wstrx(1, 3, narrow) != win.wstrx(2, 3, wide)) {samePos = false;}
+            }
+        }
+    }
+    check(matched, "non-ASCII at every position around a block");
+    check(samePos, "returned position matches the wide string's");
+
+    // Wrapping and clipping at the edge of the window
+    std::string longer(130, 'x');
+    longer[118] = '\xC3';
+    longer[119] = '\xA9';
+    check(win.wstrp(0, 0, longer) == win.wstrp(0, 0, std::wstring(118, L'x') + L"é" + std::wstring(10, L'x')), "wrapped position matches the wide string's");
+    check(win.schar(0, 118) == L'é' && win.schar(1, 0) == L'x', "character before the wrap");
+
+    // Keys read by the input thread go through the same decoder
+    int keys[2];
+    check(pipe(keys) == 0 && npp::minput.start(false, keys[0]), "input thread started");
+    check(typed(keys[1], "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z") == L"aé€😀z", "typed characters of every length");
+    check(typed(keys[1], "a\x80" "b") == L"a�b", "typed stray continuation byte doesn't swallow the next key");
+    check(typed(keys[1], "\xF8" "a\xFF" "b") == L"�a�b", "typed lead bytes past F4");
+    check(typed(keys[1], "\xC0\xAF\xED\xA0\x80") == L"�����", "typed overlong encoding and surrogate");
+    // The rest of a character is waited on for a bit (like the rest of an escape sequence), so the reader sees the first part on its own
+    if (::write(keys[1], "\xE2\x82", 2) < 0) {}
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    check(typed(keys[1], "\xAC") == L"€", "typed character split across reads");
+    check(typed(keys[1], "\xF0\x9F") == L"��", "typed character that never finishes");
+    npp::minput.stop();
+    close(keys[0]);
+    close(keys[1]);
+
+    npp::end();
+    printf("%s\n", failures ? "UTF-8 tests failed" : "UTF-8 tests passed");
+    return failures ? 1 : 0;
+}